@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <concepts>
 #include <cstring>
 #include <limits>
 #include <stdexcept>
@@ -63,6 +64,13 @@ struct AABound
     Copyright (c) 2003-2007 Christopher Kulla
 */
 
+/// Ray callbacks providing intersectLeaf() get whole leaves (a range of object slots) at once
+template<typename RayCallback>
+concept BIHLeafRayCallback = requires(RayCallback& callback, G3D::Ray const& ray, uint32 first, uint32 count, float& distance, bool stopAtFirstHit)
+{
+    { callback.intersectLeaf(ray, first, count, distance, stopAtFirstHit) } -> std::convertible_to<bool>;
+};
+
 class BIH
 {
 private:
@@ -117,6 +125,7 @@ public:
         delete[] dat.indices;
     }
     [[nodiscard]] uint32 primCount() const { return objects.size(); }
+    [[nodiscard]] uint32 objectAt(uint32 slot) const { return objects[slot]; }
     G3D::AABox const& bound() const { return bounds; }
 
     template<typename RayCallback>
@@ -233,12 +242,20 @@ public:
                     {
                         // leaf - test some objects
                         int n = tree[node + 1];
-                        while (n > 0)
+                        if constexpr (BIHLeafRayCallback<RayCallback>)
                         {
-                            bool hit = intersectCallback(r, objects[offset], maxDist, stopAtFirstHit);
+                            bool hit = n > 0 && intersectCallback.intersectLeaf(r, offset, n, maxDist, stopAtFirstHit);
                             if (stopAtFirstHit && hit) { return; }
-                            --n;
-                            ++offset;
+                        }
+                        else
+                        {
+                            while (n > 0)
+                            {
+                                bool hit = intersectCallback(r, objects[offset], maxDist, stopAtFirstHit);
+                                if (stopAtFirstHit && hit) { return; }
+                                --n;
+                                ++offset;
+                            }
                         }
                         break;
                     }
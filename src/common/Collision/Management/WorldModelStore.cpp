@@ -34,6 +34,9 @@ std::shared_ptr<VMAP::WorldModel> WorldModelStore::AcquireModelInstance(std::str
             return nullptr;
         }
 
+        if (!_keepMeshData)
+            worldmodel->ReleaseMeshData();
+
         worldmodel->Flags = flags;
 
         model = _loadedModels.insert(std::pair<std::string, std::shared_ptr<VMAP::WorldModel>>(filename, worldmodel)).first;
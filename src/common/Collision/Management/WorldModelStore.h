@@ -34,9 +34,14 @@ public:
 
     std::shared_ptr<VMAP::WorldModel> AcquireModelInstance(std::string const& basepath, std::string const& filename, uint32 flags);
 
+    //! Keeps the indexed mesh of loaded models for GroupModel::GetMeshData (mmaps_generator).
+    //! Otherwise only the collision data used by ray tests stays in memory.
+    void SetKeepMeshData(bool keep) { _keepMeshData = keep; }
+
 private:
     typedef std::unordered_map<std::string, std::shared_ptr<VMAP::WorldModel>> ModelFileMap;
     ModelFileMap _loadedModels;
+    bool _keepMeshData{false};
 
     std::mutex _lock;
 };
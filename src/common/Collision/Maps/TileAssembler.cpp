@@ -21,9 +21,12 @@
 #include "MapTree.h"
 #include "VMapDefinitions.h"
 #include <boost/filesystem.hpp>
+#include <atomic>
+#include <functional>
 #include <iomanip>
 #include <set>
 #include <sstream>
+#include <thread>
 
 using G3D::Vector3;
 using G3D::AABox;
@@ -37,6 +40,32 @@ template<> struct BoundsTrait<VMAP::ModelSpawn*>
 
 namespace VMAP
 {
+    //! runs job(0) .. job(count - 1) on up to threads workers, every index exactly once
+    static void ParallelFor(std::size_t count, uint32 threads, std::function<void(std::size_t)> const& job)
+    {
+        std::atomic<std::size_t> next = 0;
+        auto worker = [&]()
+        {
+            for (std::size_t i = next++; i < count; i = next++)
+            {
+                job(i);
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (uint32 i = 1; i < std::min<std::size_t>(threads, count); ++i)
+        {
+            workers.emplace_back(worker);
+        }
+
+        worker();
+
+        for (std::thread& thread : workers)
+        {
+            thread.join();
+        }
+    }
+
     bool readChunk(FILE* rf, char* dest, char const* compare, uint32 len)
     {
         if (fread(dest, sizeof(char), len, rf) != len) { return false; }
@@ -52,8 +81,8 @@ namespace VMAP
 
     //=================================================================
 
-    TileAssembler::TileAssembler(std::string const& pSrcDirName, std::string const& pDestDirName)
-        : iDestDir(pDestDirName), iSrcDir(pSrcDirName)
+    TileAssembler::TileAssembler(std::string const& pSrcDirName, std::string const& pDestDirName, uint32 threads, bool incremental)
+        : iDestDir(pDestDirName), iSrcDir(pSrcDirName), iThreads(threads ? threads : std::max(1u, std::thread::hardware_concurrency())), iIncremental(incremental)
     {
         boost::filesystem::create_directory(iDestDir);
         //init();
@@ -79,12 +108,26 @@ namespace VMAP
             std::vector<ModelSpawn*> mapSpawns;
             UniqueEntryMap::iterator entry;
             printf("Calculating model bounds for map %u...\n", map_iter->first);
+
+            // M2 models don't have a bound set in WDT/ADT placement data, i still think they're not used for LoS at all on retail
+            std::vector<ModelSpawn*> m2Spawns;
             for (entry = map_iter->second->UniqueEntries.begin(); entry != map_iter->second->UniqueEntries.end(); ++entry)
             {
-                // M2 models don't have a bound set in WDT/ADT placement data, i still think they're not used for LoS at all on retail
                 if (entry->second.flags & MOD_M2)
                 {
-                    if (!calculateTransformedBound(entry->second))
+                    m2Spawns.push_back(&entry->second);
+                }
+            }
+
+            std::vector<char> m2BoundResults(m2Spawns.size());
+            ParallelFor(m2Spawns.size(), iThreads, [&](std::size_t i) { m2BoundResults[i] = calculateTransformedBound(*m2Spawns[i]); });
+
+            std::size_t m2Index = 0;
+            for (entry = map_iter->second->UniqueEntries.begin(); entry != map_iter->second->UniqueEntries.end(); ++entry)
+            {
+                if (entry->second.flags & MOD_M2)
+                {
+                    if (!m2BoundResults[m2Index++])
                     {
                         break;
                     }
@@ -195,19 +238,46 @@ namespace VMAP
 
         // add an object models, listed in temp_gameobject_models file
         exportGameobjectModels();
-        // export objects
-        std::cout << "\nConverting Model Files" << std::endl;
-        for (std::set<std::string>::iterator mfile = spawnedModelFiles.begin(); mfile != spawnedModelFiles.end(); ++mfile)
+        // export objects, every model is written to its own file so the worker order does not matter
+        std::cout << "\nConverting Model Files using " << iThreads << " thread(s)" << std::endl;
+        std::vector<std::string> modelFiles(spawnedModelFiles.begin(), spawnedModelFiles.end());
+        std::vector<char> modelResults(modelFiles.size(), 1);
+        std::atomic<uint32> skippedModels = 0;
+        std::atomic<bool> failed = false;
+        ParallelFor(modelFiles.size(), iThreads, [&](std::size_t i)
+        {
+            if (failed)
+            {
+                return;
+            }
+
+            if (iIncremental && isModelUpToDate(modelFiles[i]))
+            {
+                ++skippedModels;
+                return;
+            }
+
+            if (!convertRawFile(modelFiles[i]))
+            {
+                modelResults[i] = 0;
+                failed = true;
+            }
+        });
+
+        for (std::size_t i = 0; i < modelFiles.size(); ++i)
         {
-            std::cout << "Converting " << *mfile << std::endl;
-            if (!convertRawFile(*mfile))
+            if (!modelResults[i])
             {
-                std::cout << "error converting " << *mfile << std::endl;
+                std::cout << "error converting " << modelFiles[i] << std::endl;
                 success = false;
-                break;
             }
         }
 
+        if (skippedModels)
+        {
+            std::cout << "Skipped " << skippedModels << " up to date model(s)" << std::endl;
+        }
+
         //cleanup:
         for (MapData::iterator map_iter = mapData.begin(); map_iter != mapData.end(); ++map_iter)
         {
@@ -366,11 +436,48 @@ namespace VMAP
             model.setGroupModels(groupsArray);
         }
 
-        success = model.writeFile(iDestDir + "/" + pModelFilename + ".vmo");
+        // written under a temporary name, so a killed run never leaves a truncated model behind
+        std::string const modelPath = iDestDir + "/" + pModelFilename + ".vmo";
+        success = model.writeFile(modelPath + ".tmp");
+        if (success)
+        {
+            boost::system::error_code error;
+            boost::filesystem::rename(modelPath + ".tmp", modelPath, error);
+            success = !error;
+        }
         //std::cout << "readRawFile2: '" << pModelFilename << "' tris: " << nElements << " nodes: " << nNodes << std::endl;
         return success;
     }
 
+    bool TileAssembler::isModelUpToDate(std::string const& pModelFilename) const
+    {
+        boost::system::error_code error;
+        std::time_t rawTime = boost::filesystem::last_write_time(iSrcDir + "/" + pModelFilename, error);
+        if (error)
+        {
+            return false;
+        }
+
+        std::string const modelPath = iDestDir + "/" + pModelFilename + ".vmo";
+        std::time_t convertedTime = boost::filesystem::last_write_time(modelPath, error);
+        if (error || convertedTime <= rawTime)
+        {
+            return false;
+        }
+
+        // the assembler has no options changing the output, only models of another format version must be redone
+        FILE* rf = fopen(modelPath.c_str(), "rb");
+        if (!rf)
+        {
+            return false;
+        }
+
+        char magic[8];
+        bool upToDate = readChunk(rf, magic, VMAP_MAGIC, 8);
+        fclose(rf);
+        return upToDate;
+    }
+
     void TileAssembler::exportGameobjectModels()
     {
         FILE* model_list = fopen((iSrcDir + "/" + "temp_gameobject_models").c_str(), "rb");
@@ -97,9 +97,14 @@ namespace VMAP
         G3D::Table<std::string, unsigned int > iUniqueNameIds;
         MapData mapData;
         std::set<std::string> spawnedModelFiles;
+        uint32 iThreads;
+        bool iIncremental;
+
+        bool isModelUpToDate(std::string const& pModelFilename) const;
 
     public:
-        TileAssembler(std::string const& pSrcDirName, std::string const& pDestDirName);
+        //! threads 0 uses one worker per hardware thread, incremental skips models whose .vmo is newer than the raw file and has the current format version
+        TileAssembler(std::string const& pSrcDirName, std::string const& pDestDirName, uint32 threads = 0, bool incremental = false);
         virtual ~TileAssembler();
 
         bool convertWorld2();
@@ -0,0 +1,189 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TriangleSoA.h"
+#include "BoundingIntervalHierarchy.h"
+#include "WorldModel.h"
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VMAP_TRIANGLE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace VMAP
+{
+    static constexpr float TRIANGLE_EPS = 1e-5f;
+
+    void TriangleSoA::build(std::vector<G3D::Vector3> const& vertices, std::vector<MeshTriangle> const& triangles, BIH const& tree)
+    {
+        _size = tree.primCount();
+
+        // padded so the last leaf can always be loaded as a full SSE register
+        for (std::vector<float>& component : _components)
+            component.assign(_size + LANES - 1, 0.0f);
+
+        for (uint32 slot = 0; slot < _size; ++slot)
+        {
+            MeshTriangle const& tri = triangles[tree.objectAt(slot)];
+            G3D::Vector3 const& v0 = vertices[tri.idx0];
+            G3D::Vector3 const e1 = vertices[tri.idx1] - v0;
+            G3D::Vector3 const e2 = vertices[tri.idx2] - v0;
+
+            _components[V0_X][slot] = v0.x;
+            _components[V0_Y][slot] = v0.y;
+            _components[V0_Z][slot] = v0.z;
+            _components[E1_X][slot] = e1.x;
+            _components[E1_Y][slot] = e1.y;
+            _components[E1_Z][slot] = e1.z;
+            _components[E2_X][slot] = e2.x;
+            _components[E2_Y][slot] = e2.y;
+            _components[E2_Z][slot] = e2.z;
+        }
+    }
+
+    void TriangleSoA::clear()
+    {
+        for (std::vector<float>& component : _components)
+        {
+            component.clear();
+            component.shrink_to_fit();
+        }
+
+        _size = 0;
+    }
+
+    bool TriangleSoA::intersectRayScalar(G3D::Ray const& ray, uint32 first, uint32 count, float& distance) const
+    {
+        // See RTR2 ch. 13.7 for the algorithm.
+        G3D::Vector3 const& dir = ray.direction();
+        bool hit = false;
+
+        for (uint32 slot = first; slot < first + count; ++slot)
+        {
+            G3D::Vector3 const v0(_components[V0_X][slot], _components[V0_Y][slot], _components[V0_Z][slot]);
+            G3D::Vector3 const e1(_components[E1_X][slot], _components[E1_Y][slot], _components[E1_Z][slot]);
+            G3D::Vector3 const e2(_components[E2_X][slot], _components[E2_Y][slot], _components[E2_Z][slot]);
+
+            G3D::Vector3 const p(dir.cross(e2));
+            float const a = e1.dot(p);
+            if (std::fabs(a) < TRIANGLE_EPS)
+                continue;
+
+            float const f = 1.0f / a;
+            G3D::Vector3 const s(ray.origin() - v0);
+            float const u = f * s.dot(p);
+            if (u < 0.0f || u > 1.0f)
+                continue;
+
+            G3D::Vector3 const q(s.cross(e1));
+            float const v = f * dir.dot(q);
+            if (v < 0.0f || (u + v) > 1.0f)
+                continue;
+
+            float const t = f * e2.dot(q);
+            if (t > 0.0f && t < distance)
+            {
+                distance = t;
+                hit = true;
+            }
+        }
+
+        return hit;
+    }
+
+#ifdef VMAP_TRIANGLE_SSE
+    bool TriangleSoA::intersectRay(G3D::Ray const& ray, uint32 first, uint32 count, float& distance) const
+    {
+        __m128 const dirX = _mm_set1_ps(ray.direction().x);
+        __m128 const dirY = _mm_set1_ps(ray.direction().y);
+        __m128 const dirZ = _mm_set1_ps(ray.direction().z);
+        __m128 const orgX = _mm_set1_ps(ray.origin().x);
+        __m128 const orgY = _mm_set1_ps(ray.origin().y);
+        __m128 const orgZ = _mm_set1_ps(ray.origin().z);
+        __m128 const zero = _mm_setzero_ps();
+        __m128 const one = _mm_set1_ps(1.0f);
+        __m128 const eps = _mm_set1_ps(TRIANGLE_EPS);
+        __m128 const absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+        bool hit = false;
+
+        for (uint32 base = first; base < first + count; base += LANES)
+        {
+            __m128 const v0X = _mm_loadu_ps(&_components[V0_X][base]);
+            __m128 const v0Y = _mm_loadu_ps(&_components[V0_Y][base]);
+            __m128 const v0Z = _mm_loadu_ps(&_components[V0_Z][base]);
+            __m128 const e1X = _mm_loadu_ps(&_components[E1_X][base]);
+            __m128 const e1Y = _mm_loadu_ps(&_components[E1_Y][base]);
+            __m128 const e1Z = _mm_loadu_ps(&_components[E1_Z][base]);
+            __m128 const e2X = _mm_loadu_ps(&_components[E2_X][base]);
+            __m128 const e2Y = _mm_loadu_ps(&_components[E2_Y][base]);
+            __m128 const e2Z = _mm_loadu_ps(&_components[E2_Z][base]);
+
+            // p = dir x e2, a = e1 . p
+            __m128 const pX = _mm_sub_ps(_mm_mul_ps(dirY, e2Z), _mm_mul_ps(dirZ, e2Y));
+            __m128 const pY = _mm_sub_ps(_mm_mul_ps(dirZ, e2X), _mm_mul_ps(dirX, e2Z));
+            __m128 const pZ = _mm_sub_ps(_mm_mul_ps(dirX, e2Y), _mm_mul_ps(dirY, e2X));
+            __m128 const a = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1X, pX), _mm_mul_ps(e1Y, pY)), _mm_mul_ps(e1Z, pZ));
+            __m128 mask = _mm_cmpnlt_ps(_mm_and_ps(a, absMask), eps);
+
+            __m128 const f = _mm_div_ps(one, a);
+            __m128 const sX = _mm_sub_ps(orgX, v0X);
+            __m128 const sY = _mm_sub_ps(orgY, v0Y);
+            __m128 const sZ = _mm_sub_ps(orgZ, v0Z);
+            __m128 const u = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(sX, pX), _mm_mul_ps(sY, pY)), _mm_mul_ps(sZ, pZ)));
+            mask = _mm_and_ps(mask, _mm_and_ps(_mm_cmpnlt_ps(u, zero), _mm_cmpngt_ps(u, one)));
+
+            // q = s x e1
+            __m128 const qX = _mm_sub_ps(_mm_mul_ps(sY, e1Z), _mm_mul_ps(sZ, e1Y));
+            __m128 const qY = _mm_sub_ps(_mm_mul_ps(sZ, e1X), _mm_mul_ps(sX, e1Z));
+            __m128 const qZ = _mm_sub_ps(_mm_mul_ps(sX, e1Y), _mm_mul_ps(sY, e1X));
+            __m128 const v = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(dirX, qX), _mm_mul_ps(dirY, qY)), _mm_mul_ps(dirZ, qZ)));
+            mask = _mm_and_ps(mask, _mm_and_ps(_mm_cmpnlt_ps(v, zero), _mm_cmpngt_ps(_mm_add_ps(u, v), one)));
+
+            __m128 const t = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(e2X, qX), _mm_mul_ps(e2Y, qY)), _mm_mul_ps(e2Z, qZ)));
+            mask = _mm_and_ps(mask, _mm_and_ps(_mm_cmpgt_ps(t, zero), _mm_cmplt_ps(t, _mm_set1_ps(distance))));
+
+            int lanes = _mm_movemask_ps(mask);
+            uint32 const remaining = first + count - base;
+            if (remaining < LANES)
+                lanes &= (1 << remaining) - 1;
+
+            if (!lanes)
+                continue;
+
+            alignas(16) float times[LANES];
+            _mm_store_ps(times, t);
+            for (uint32 lane = 0; lane < LANES; ++lane)
+            {
+                if ((lanes & (1 << lane)) && times[lane] < distance)
+                {
+                    distance = times[lane];
+                    hit = true;
+                }
+            }
+        }
+
+        return hit;
+    }
+#else
+    bool TriangleSoA::intersectRay(G3D::Ray const& ray, uint32 first, uint32 count, float& distance) const
+    {
+        return intersectRayScalar(ray, first, count, distance);
+    }
+#endif
+}
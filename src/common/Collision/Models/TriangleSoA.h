@@ -0,0 +1,65 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _TRIANGLESOA_H
+#define _TRIANGLESOA_H
+
+#include "Define.h"
+#include <G3D/Ray.h>
+#include <G3D/Vector3.h>
+#include <array>
+#include <vector>
+
+class BIH;
+
+namespace VMAP
+{
+    class MeshTriangle;
+
+    /*! Triangles of a group model as structure of arrays (first vertex and both edges),
+        stored in BIH object order so every leaf is a contiguous slot range that is
+        tested four triangles at a time with SSE. Other platforms use the scalar path. */
+    class TriangleSoA
+    {
+    public:
+        static constexpr uint32 LANES = 4;
+
+        void build(std::vector<G3D::Vector3> const& vertices, std::vector<MeshTriangle> const& triangles, BIH const& tree);
+        void clear();
+
+        [[nodiscard]] uint32 size() const { return _size; }
+
+        //! tests slots [first, first + count), lowers distance and returns true on a closer hit
+        bool intersectRay(G3D::Ray const& ray, uint32 first, uint32 count, float& distance) const;
+        //! same as intersectRay, one triangle at a time
+        bool intersectRayScalar(G3D::Ray const& ray, uint32 first, uint32 count, float& distance) const;
+
+    private:
+        enum Component
+        {
+            V0_X, V0_Y, V0_Z,
+            E1_X, E1_Y, E1_Z,
+            E2_X, E2_Y, E2_Z,
+            COMPONENT_COUNT
+        };
+
+        std::array<std::vector<float>, COMPONENT_COUNT> _components;
+        uint32 _size{0};
+    };
+}
+
+#endif // _TRIANGLESOA_H
@@ -31,59 +31,6 @@ template<> struct BoundsTrait<VMAP::GroupModel>
 
 namespace VMAP
 {
-    bool IntersectTriangle(MeshTriangle const& tri, std::vector<Vector3>::const_iterator points, G3D::Ray const& ray, float& distance)
-    {
-        static const float EPS = 1e-5f;
-
-        // See RTR2 ch. 13.7 for the algorithm.
-
-        const Vector3 e1 = points[tri.idx1] - points[tri.idx0];
-        const Vector3 e2 = points[tri.idx2] - points[tri.idx0];
-        const Vector3 p(ray.direction().cross(e2));
-        const float a = e1.dot(p);
-
-        if (std::fabs(a) < EPS)
-        {
-            // Determinant is ill-conditioned; abort early
-            return false;
-        }
-
-        const float f = 1.0f / a;
-        const Vector3 s(ray.origin() - points[tri.idx0]);
-        const float u = f * s.dot(p);
-
-        if ((u < 0.0f) || (u > 1.0f))
-        {
-            // We hit the plane of the m_geometry, but outside the m_geometry
-            return false;
-        }
-
-        const Vector3 q(s.cross(e1));
-        const float v = f * ray.direction().dot(q);
-
-        if ((v < 0.0f) || ((u + v) > 1.0f))
-        {
-            // We hit the plane of the triangle, but outside the triangle
-            return false;
-        }
-
-        const float t = f * e2.dot(q);
-
-        if ((t > 0.0f) && (t < distance))
-        {
-            // This is a new hit, closer than the previous one
-            distance = t;
-
-            /* baryCoord[0] = 1.0 - u - v;
-            baryCoord[1] = u;
-            baryCoord[2] = v; */
-
-            return true;
-        }
-        // This hit is after the previous hit, so ignore it
-        return false;
-    }
-
     class TriBoundFunc
     {
     public:
@@ -313,7 +260,7 @@ namespace VMAP
 
     GroupModel::GroupModel(GroupModel const& other):
         iBound(other.iBound), iMogpFlags(other.iMogpFlags), iGroupWMOID(other.iGroupWMOID),
-        vertices(other.vertices), triangles(other.triangles), meshTree(other.meshTree), iLiquid(0)
+        vertices(other.vertices), triangles(other.triangles), meshTree(other.meshTree), meshTriangles(other.meshTriangles), iLiquid(0)
     {
         if (other.iLiquid)
         {
@@ -327,6 +274,7 @@ namespace VMAP
         triangles.swap(tri);
         TriBoundFunc bFunc(vertices);
         meshTree.build(triangles, bFunc);
+        meshTriangles.build(vertices, triangles, meshTree);
     }
 
     bool GroupModel::writeToFile(FILE* wf)
@@ -385,6 +333,7 @@ namespace VMAP
         uint32 count = 0;
         triangles.clear();
         vertices.clear();
+        meshTriangles.clear();
         delete iLiquid;
         iLiquid = nullptr;
 
@@ -413,6 +362,7 @@ namespace VMAP
         // read mesh BIH
         if (result && !readChunk(rf, chunk, "MBIH", 4)) { result = false; }
         if (result) { result = meshTree.readFromFile(rf); }
+        if (result) { meshTriangles.build(vertices, triangles, meshTree); }
 
         // write liquid data
         if (result && !readChunk(rf, chunk, "LIQU", 4)) { result = false; }
@@ -426,27 +376,24 @@ namespace VMAP
 
     struct GModelRayCallback
     {
-        GModelRayCallback(std::vector<MeshTriangle> const& tris, std::vector<Vector3> const& vert):
-            vertices(vert.begin()), triangles(tris.begin()), hit(false) { }
-        bool operator()(G3D::Ray const& ray, uint32 entry, float& distance, bool /*StopAtFirstHit*/)
+        GModelRayCallback(TriangleSoA const& tris): triangles(tris), hit(false) { }
+        bool intersectLeaf(G3D::Ray const& ray, uint32 first, uint32 count, float& distance, bool /*StopAtFirstHit*/)
         {
-            bool result = IntersectTriangle(triangles[entry], vertices, ray, distance);
-            if (result) { hit = true; }
+            if (triangles.intersectRay(ray, first, count, distance)) { hit = true; }
             return hit;
         }
-        std::vector<Vector3>::const_iterator vertices;
-        std::vector<MeshTriangle>::const_iterator triangles;
+        TriangleSoA const& triangles;
         bool hit;
     };
 
     bool GroupModel::IntersectRay(G3D::Ray const& ray, float& distance, bool stopAtFirstHit) const
     {
-        if (triangles.empty())
+        if (!meshTriangles.size())
         {
             return false;
         }
 
-        GModelRayCallback callback(triangles, vertices);
+        GModelRayCallback callback(meshTriangles);
         meshTree.intersectRay(ray, callback, distance, stopAtFirstHit);
         return callback.hit;
     }
@@ -462,7 +409,7 @@ namespace VMAP
 
     GroupModel::InsideResult GroupModel::IsInsideObject(G3D::Ray const& ray, float& z_dist) const
     {
-        if (triangles.empty() || !IsInsideOrAboveBound(iBound, ray.origin()))
+        if (!meshTriangles.size() || !IsInsideOrAboveBound(iBound, ray.origin()))
             return OUT_OF_BOUNDS;
 
         if (meshTree.bound().high().z >= ray.origin().z)
@@ -518,6 +465,12 @@ namespace VMAP
         liquid = iLiquid;
     }
 
+    void GroupModel::ReleaseMeshData()
+    {
+        std::vector<Vector3>().swap(vertices);
+        std::vector<MeshTriangle>().swap(triangles);
+    }
+
     // ===================== WorldModel ==================================
 
     void WorldModel::setGroupModels(std::vector<GroupModel>& models)
@@ -704,4 +657,10 @@ namespace VMAP
     {
         outGroupModels = groupModels;
     }
+
+    void WorldModel::ReleaseMeshData()
+    {
+        for (GroupModel& groupModel : groupModels)
+            groupModel.ReleaseMeshData();
+    }
 }
@@ -20,6 +20,7 @@
 
 #include "BoundingIntervalHierarchy.h"
 #include "Define.h"
+#include "TriangleSoA.h"
 #include <G3D/AABox.h>
 #include <G3D/Ray.h>
 #include <G3D/Vector3.h>
@@ -93,6 +94,8 @@ namespace VMAP
         [[nodiscard]] uint32 GetMogpFlags() const { return iMogpFlags; }
         [[nodiscard]] uint32 GetWmoID() const { return iGroupWMOID; }
         void GetMeshData(std::vector<G3D::Vector3>& outVertices, std::vector<MeshTriangle>& outTriangles, WmoLiquid*& liquid);
+        //! drops vertices and triangles, ray tests only need meshTree and meshTriangles
+        void ReleaseMeshData();
     protected:
         G3D::AABox iBound;
         uint32 iMogpFlags{0};// 0x8 outdor; 0x2000 indoor
@@ -100,6 +103,7 @@ namespace VMAP
         std::vector<G3D::Vector3> vertices;
         std::vector<MeshTriangle> triangles;
         BIH meshTree;
+        TriangleSoA meshTriangles; //!< triangles in meshTree leaf order, built on load
         WmoLiquid* iLiquid{nullptr};
     };
     /*! Holds a model (converted M2 or WMO) in its original coordinate space */
@@ -116,6 +120,7 @@ namespace VMAP
         bool writeFile(std::string const& filename);
         bool readFile(std::string const& filename);
         void GetGroupModels(std::vector<GroupModel>& outGroupModels);
+        void ReleaseMeshData();
         uint32 Flags;
     protected:
         uint32 RootWMOID{0};
@@ -0,0 +1,55 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FrameArena.h"
+
+using namespace Acore;
+
+FrameArena& FrameArena::Instance()
+{
+    thread_local FrameArena arena;
+    return arena;
+}
+
+FrameArena::FrameArena() : _resource(_buffer.data(), _buffer.size(), &_upstream), _depth(0) { }
+
+void FrameArena::Reset()
+{
+    if (_depth)
+        return;
+
+    _resource.release();
+}
+
+FrameArena::Scope::~Scope()
+{
+    if (!--_arena._depth && _arena.GetUpstreamSize() > ReleaseThreshold)
+        _arena.Reset();
+}
+
+void* FrameArena::CountingResource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    void* p = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    _allocated += bytes;
+    return p;
+}
+
+void FrameArena::CountingResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment)
+{
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    _allocated -= bytes;
+}
@@ -0,0 +1,101 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _FRAME_ARENA_H_
+#define _FRAME_ARENA_H_
+
+#include "Define.h"
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace Acore
+{
+    /**
+     * Per thread bump allocator for short lived containers (spell target lists and
+     * similar temporaries built and dropped within one update).
+     *
+     * Deallocation is a no-op, memory is reclaimed as a whole by Reset(), which the
+     * owning thread calls once per tick. Containers using the arena must not outlive
+     * the Scope they were created in; Reset() is ignored while a Scope is open.
+     * A thread that never ticks gets its memory back once the arena grows past
+     * ReleaseThreshold and the last Scope closes.
+     */
+    class AC_COMMON_API FrameArena
+    {
+    public:
+        static constexpr std::size_t InitialBufferSize = 64 * 1024;
+        static constexpr std::size_t ReleaseThreshold = 4 * 1024 * 1024;
+
+        /// Arena of the calling thread
+        static FrameArena& Instance();
+
+        [[nodiscard]] std::pmr::memory_resource* GetResource() { return &_resource; }
+
+        /// Drops everything allocated since the last reset, ignored while a Scope is open
+        void Reset();
+
+        [[nodiscard]] std::size_t GetUpstreamSize() const { return _upstream.GetAllocated(); }
+
+        class Scope
+        {
+        public:
+            Scope() : _arena(Instance()) { ++_arena._depth; }
+            ~Scope();
+
+            Scope(Scope const&) = delete;
+            Scope& operator=(Scope const&) = delete;
+
+            [[nodiscard]] std::pmr::memory_resource* GetResource() const { return _arena.GetResource(); }
+
+        private:
+            FrameArena& _arena;
+        };
+
+    private:
+        FrameArena();
+
+        FrameArena(FrameArena const&) = delete;
+        FrameArena& operator=(FrameArena const&) = delete;
+
+        // Keeps track of the blocks the monotonic resource takes past the initial buffer
+        class CountingResource : public std::pmr::memory_resource
+        {
+        public:
+            [[nodiscard]] std::size_t GetAllocated() const { return _allocated; }
+
+        private:
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+            void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+            [[nodiscard]] bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override { return this == &other; }
+
+            std::size_t _allocated = 0;
+        };
+
+        alignas(std::max_align_t) std::array<std::byte, InitialBufferSize> _buffer;
+        CountingResource _upstream;
+        std::pmr::monotonic_buffer_resource _resource;
+        uint32 _depth;
+    };
+
+    /// Vector allocated from the frame arena, only valid inside a FrameArena::Scope
+    template<typename T>
+    using FrameVector = std::pmr::vector<T>;
+}
+
+#endif
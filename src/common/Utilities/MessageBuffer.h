@@ -37,6 +37,9 @@ public:
         _storage.resize(initialSize);
     }
 
+    // Takes ownership of already filled storage, the whole vector is active data
+    explicit MessageBuffer(std::vector<uint8>&& storage) : _wpos(storage.size()), _rpos(0), _storage(std::move(storage)) { }
+
     MessageBuffer(MessageBuffer const& right) :
         _wpos(right._wpos), _rpos(right._rpos), _storage(right._storage) { }
 
@@ -24,6 +24,7 @@
 */
 
 #include "AppenderDB.h"
+#include "AuthCryptoPool.h"
 #include "AuthSocketMgr.h"
 #include "Banner.h"
 #include "Config.h"
@@ -174,6 +175,13 @@ int main(int argc, char** argv)
 
     std::string bindIp = sConfigMgr->GetOption<std::string>("BindIP", "0.0.0.0");
 
+    // Start the SRP6 worker pool before accepting connections, it is stopped after the network
+    sAuthCryptoPool->Start(sConfigMgr->GetOption<int32>("LoginCrypto.WorkerThreads", 2),
+        sConfigMgr->GetOption<int32>("LoginCrypto.MaxQueueSize", 5000),
+        sConfigMgr->GetOption<int32>("LoginCrypto.MaxPendingPerIP", 16));
+
+    std::shared_ptr<void> sAuthCryptoPoolHandle(nullptr, [](void*) { sAuthCryptoPool->Stop(); });
+
     if (!sAuthSocketMgr.StartNetwork(*ioContext, bindIp, port))
     {
         LOG_ERROR("server.authserver", "Failed to initialize network");
@@ -0,0 +1,138 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuthCryptoPool.h"
+#include "Log.h"
+
+AuthCryptoPool* AuthCryptoPool::instance()
+{
+    static AuthCryptoPool instance;
+    return &instance;
+}
+
+void AuthCryptoPool::Start(uint32 threadCount, std::size_t maxQueueSize, std::size_t maxPendingPerAddress)
+{
+    if (!threadCount)
+    {
+        LOG_INFO("server.authserver", "SRP6 worker pool disabled, logon proofs are verified on the network thread.");
+        return;
+    }
+
+    _maxQueueSize = maxQueueSize;
+    _maxPendingPerAddress = maxPendingPerAddress;
+    _shutdown = false;
+
+    _workerThreads.reserve(threadCount);
+    for (uint32 i = 0; i < threadCount; ++i)
+        _workerThreads.push_back(std::thread(&AuthCryptoPool::WorkerThread, this));
+
+    LOG_INFO("server.authserver", "Started SRP6 worker pool with {} thread(s), queue size {}, {} pending job(s) per address.",
+        threadCount, maxQueueSize, maxPendingPerAddress);
+}
+
+void AuthCryptoPool::Stop()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _shutdown = true;
+    }
+
+    _condition.notify_all();
+
+    for (std::thread& thread : _workerThreads)
+        if (thread.joinable())
+            thread.join();
+
+    _workerThreads.clear();
+
+    // Destroying the queued tasks breaks their promises, AuthCryptoCallback skips those callbacks
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_queueSize)
+        LOG_INFO("server.authserver", "SRP6 worker pool stopped, dropped {} queued job(s).", _queueSize);
+
+    _queues.clear();
+    _readyAddresses.clear();
+    _queueSize = 0;
+}
+
+bool AuthCryptoPool::Enqueue(boost::asio::ip::address const& address, Task&& task)
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        if (_shutdown)
+            return false;
+
+        if (_maxQueueSize && _queueSize >= _maxQueueSize)
+            return false;
+
+        AddressQueue& queue = _queues[address];
+        if (_maxPendingPerAddress && queue.Tasks.size() + queue.Running >= _maxPendingPerAddress)
+            return false;
+
+        // Address becomes eligible for the round-robin again only when it has nothing else waiting
+        if (queue.Tasks.empty())
+            _readyAddresses.push_back(address);
+
+        queue.Tasks.push_back(std::move(task));
+        ++_queueSize;
+    }
+
+    _condition.notify_one();
+    return true;
+}
+
+std::size_t AuthCryptoPool::GetQueueSize() const
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    return _queueSize;
+}
+
+void AuthCryptoPool::WorkerThread()
+{
+    for (;;)
+    {
+        Task task;
+        boost::asio::ip::address address;
+
+        {
+            std::unique_lock<std::mutex> guard(_lock);
+            _condition.wait(guard, [this] { return _shutdown || !_readyAddresses.empty(); });
+
+            if (_shutdown)
+                return;
+
+            address = _readyAddresses.front();
+            _readyAddresses.pop_front();
+
+            AddressQueue& queue = _queues[address];
+            task = std::move(queue.Tasks.front());
+            queue.Tasks.pop_front();
+            ++queue.Running;
+            --_queueSize;
+
+            if (!queue.Tasks.empty())
+                _readyAddresses.push_back(address);
+        }
+
+        task();
+
+        std::lock_guard<std::mutex> guard(_lock);
+        auto itr = _queues.find(address);
+        if (itr != _queues.end() && !--itr->second.Running && itr->second.Tasks.empty())
+            _queues.erase(itr);
+    }
+}
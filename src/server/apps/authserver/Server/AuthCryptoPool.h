@@ -0,0 +1,125 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AuthCryptoPool_h__
+#define AuthCryptoPool_h__
+
+#include "Define.h"
+#include <boost/asio/ip/address.hpp>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Bounded worker pool running the CPU heavy SRP6 steps of the logon handshake
+ * away from the network thread.
+ *
+ * Jobs are queued per remote address and workers pick addresses round-robin, so
+ * a single address reconnecting aggressively cannot starve everyone else.
+ * Once the pool (or the address) is saturated Enqueue fails and the caller is
+ * expected to reject the attempt instead of blocking.
+ */
+class AuthCryptoPool
+{
+public:
+    using Task = std::function<void()>;
+
+    static AuthCryptoPool* instance();
+
+    void Start(uint32 threadCount, std::size_t maxQueueSize, std::size_t maxPendingPerAddress);
+    /// Joins the workers, jobs still queued are dropped without running
+    void Stop();
+
+    [[nodiscard]] bool IsActive() const { return !_workerThreads.empty(); }
+
+    bool Enqueue(boost::asio::ip::address const& address, Task&& task);
+
+    [[nodiscard]] std::size_t GetQueueSize() const;
+
+private:
+    AuthCryptoPool() = default;
+    ~AuthCryptoPool() = default;
+
+    AuthCryptoPool(AuthCryptoPool const&) = delete;
+    AuthCryptoPool& operator=(AuthCryptoPool const&) = delete;
+
+    void WorkerThread();
+
+    struct AddressQueue
+    {
+        std::deque<Task> Tasks;
+        std::size_t Running = 0;
+    };
+
+    mutable std::mutex _lock;
+    std::condition_variable _condition;
+    std::map<boost::asio::ip::address, AddressQueue> _queues;
+    std::deque<boost::asio::ip::address> _readyAddresses;
+    std::vector<std::thread> _workerThreads;
+    std::size_t _queueSize = 0;
+    std::size_t _maxQueueSize = 0;
+    std::size_t _maxPendingPerAddress = 0;
+    bool _shutdown = false;
+};
+
+#define sAuthCryptoPool AuthCryptoPool::instance()
+
+/// Result of a job handed to AuthCryptoPool, invoked from the owning session's Update()
+class AuthCryptoCallback
+{
+public:
+    AuthCryptoCallback(std::future<void>&& future, std::function<void()>&& callback)
+        : _future(std::move(future)), _callback(std::move(callback)) { }
+
+    AuthCryptoCallback(AuthCryptoCallback&&) = default;
+    AuthCryptoCallback& operator=(AuthCryptoCallback&&) = default;
+
+    bool InvokeIfReady()
+    {
+        if (_future.valid() && _future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        {
+            try
+            {
+                _future.get();
+            }
+            catch (std::future_error const& error)
+            {
+                // Job was dropped by AuthCryptoPool::Stop without running, there is no result to deliver
+                if (error.code() != std::future_errc::broken_promise)
+                    throw;
+
+                return true;
+            }
+
+            _callback();
+            return true;
+        }
+
+        return false;
+    }
+
+private:
+    std::future<void> _future;
+    std::function<void()> _callback;
+};
+
+#endif // AuthCryptoPool_h__
@@ -112,6 +112,17 @@ static_assert(sizeof(sAuthReconnectProof_C) == (1 + 16 + 20 + 20 + 1));
 
 #pragma pack(pop)
 
+// Copy of the logon proof packet handed over to the SRP6 worker pool, the read buffer is reused by then
+struct LogonProofContext
+{
+    Acore::Crypto::SRP6::EphemeralKey A;
+    Acore::Crypto::SHA1::Digest ClientM;
+    Acore::Crypto::SHA1::Digest CrcHash;
+    bool SentToken = false;
+    std::string Token;
+    Optional<SessionKey> K;
+};
+
 std::array<uint8, 16> VersionChallenge = { { 0xBA, 0xA3, 0x1E, 0x99, 0xA0, 0x0B, 0x21, 0x57, 0xFC, 0x37, 0x3F, 0xB3, 0x69, 0xCD, 0xD2, 0xF1 } };
 
 #define MAX_ACCEPTED_CHALLENGE_SIZE (sizeof(AUTH_LOGON_CHALLENGE_C) + 16)
@@ -183,7 +194,26 @@ bool AuthSession::Update()
         return false;
 
     _queryProcessor.ProcessReadyCallbacks();
+    _cryptoProcessor.ProcessReadyCallbacks();
+
+    return true;
+}
+
+bool AuthSession::QueueCryptoWork(std::function<void()>&& work, std::function<void()>&& callback)
+{
+    if (!sAuthCryptoPool->IsActive())
+    {
+        work();
+        callback();
+        return true;
+    }
+
+    auto task = std::make_shared<std::packaged_task<void()>>(std::move(work));
+    std::future<void> future = task->get_future();
+    if (!sAuthCryptoPool->Enqueue(GetRemoteIpAddress(), [task]() { (*task)(); }))
+        return false;
 
+    _cryptoProcessor.AddCallback(AuthCryptoCallback(std::move(future), std::move(callback)));
     return true;
 }
 
@@ -406,10 +436,31 @@ void AuthSession::LogonChallengeCallback(PreparedQueryResult result)
         }
     }
 
-    _srp6.emplace(_accountInfo.Login,
-        fields[13].Get<Binary, Acore::Crypto::SRP6::SALT_LENGTH>(),
-        fields[14].Get<Binary, Acore::Crypto::SRP6::VERIFIER_LENGTH>());
+    // Computing B is a modular exponentiation, keep it off the network thread
+    auto srp6 = std::make_shared<Optional<Acore::Crypto::SRP6>>();
+    auto work = [srp6, login = _accountInfo.Login,
+        salt = fields[13].Get<Binary, Acore::Crypto::SRP6::SALT_LENGTH>(),
+        verifier = fields[14].Get<Binary, Acore::Crypto::SRP6::VERIFIER_LENGTH>()]()
+    {
+        srp6->emplace(login, salt, verifier);
+    };
+
+    auto callback = [this, srp6, pkt, securityFlags]() mutable
+    {
+        _srp6.emplace(std::move(**srp6));
+        SendLogonChallengeResult(pkt, securityFlags);
+    };
 
+    if (!QueueCryptoWork(std::move(work), std::move(callback)))
+    {
+        LOG_DEBUG("server.authserver", "'{}:{}' [AuthChallenge] SRP6 worker pool is saturated, rejecting account {}", ipAddress, port, _accountInfo.Login);
+        pkt << uint8(WOW_FAIL_DB_BUSY);
+        SendPacket(pkt);
+    }
+}
+
+void AuthSession::SendLogonChallengeResult(ByteBuffer& pkt, uint8 securityFlags)
+{
     // Fill the response packet with the result
     if (AuthHelper::IsAcceptedClientBuild(_build))
     {
@@ -443,7 +494,7 @@ void AuthSession::LogonChallengeCallback(PreparedQueryResult result)
             pkt << uint8(1);
 
         LOG_DEBUG("server.authserver", "'{}:{}' [AuthChallenge] account {} is using '{}' locale ({})",
-            ipAddress, port, _accountInfo.Login, _localizationName, GetLocaleByName(_localizationName));
+            GetRemoteIpAddress().to_string(), GetRemotePort(), _accountInfo.Login, _localizationName, GetLocaleByName(_localizationName));
 
         _status = STATUS_LOGON_PROOF;
     }
@@ -470,20 +521,59 @@ bool AuthSession::HandleLogonProof()
         return false;
     }
 
+    if (!_srp6)
+        return false;
+
+    auto proof = std::make_shared<LogonProofContext>();
+    proof->A = logonProof->A;
+    proof->ClientM = logonProof->clientM;
+    proof->CrcHash = logonProof->crc_hash;
+    proof->SentToken = (logonProof->securityFlags & 0x04);
+
+    // The token follows the proof in the read buffer, consume it before handing the proof over
+    if (proof->SentToken && _totpSecret)
+    {
+        uint8 size = *(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C));
+        proof->Token.assign(reinterpret_cast<char*>(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C) + sizeof(size)), size);
+        GetReadBuffer().ReadCompleted(sizeof(size) + size);
+    }
+
+    // A single SRP6 instance only verifies once, the worker takes ownership of it
+    auto srp6 = std::make_shared<Acore::Crypto::SRP6>(std::move(*_srp6));
+    _srp6.reset();
+
+    auto work = [srp6, proof]()
+    {
+        proof->K = srp6->VerifyChallengeResponse(proof->A, proof->ClientM);
+    };
+
+    if (!QueueCryptoWork(std::move(work), std::bind(&AuthSession::LogonProofCallback, this, proof)))
+    {
+        LOG_DEBUG("server.authserver", "'{}:{}' [AuthChallenge] SRP6 worker pool is saturated, rejecting logon proof of account {}",
+            GetRemoteIpAddress().to_string(), GetRemotePort(), _accountInfo.Login);
+
+        ByteBuffer packet;
+        packet << uint8(AUTH_LOGON_PROOF);
+        packet << uint8(WOW_FAIL_DB_BUSY);
+        packet << uint16(0);    // LoginFlags, 1 has account message
+        SendPacket(packet);
+    }
+
+    return true;
+}
+
+void AuthSession::LogonProofCallback(std::shared_ptr<LogonProofContext> proof)
+{
     // Check if SRP6 results match (password is correct), else send an error
-    if (Optional<SessionKey> K = _srp6->VerifyChallengeResponse(logonProof->A, logonProof->clientM))
+    if (proof->K)
     {
-        _sessionKey = *K;
+        _sessionKey = *proof->K;
         // Check auth token
         bool tokenSuccess = false;
-        bool sentToken = (logonProof->securityFlags & 0x04);
+        bool sentToken = proof->SentToken;
         if (sentToken && _totpSecret)
         {
-            uint8 size = *(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C));
-            std::string token(reinterpret_cast<char*>(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C) + sizeof(size)), size);
-            GetReadBuffer().ReadCompleted(sizeof(size) + size);
-
-            uint32 incomingToken = *Acore::StringTo<uint32>(token);
+            uint32 incomingToken = *Acore::StringTo<uint32>(proof->Token);
             tokenSuccess = Acore::Crypto::TOTP::ValidateToken(*_totpSecret, incomingToken);
             memset(_totpSecret->data(), 0, _totpSecret->size());
         }
@@ -497,16 +587,16 @@ bool AuthSession::HandleLogonProof()
             packet << uint8(WOW_FAIL_UNKNOWN_ACCOUNT);
             packet << uint16(0);    // LoginFlags, 1 has account message
             SendPacket(packet);
-            return true;
+            return;
         }
 
-        if (!VerifyVersion(logonProof->A.data(), logonProof->A.size(), logonProof->crc_hash, false))
+        if (!VerifyVersion(proof->A.data(), proof->A.size(), proof->CrcHash, false))
         {
             ByteBuffer packet;
             packet << uint8(AUTH_LOGON_PROOF);
             packet << uint8(WOW_FAIL_VERSION_INVALID);
             SendPacket(packet);
-            return true;
+            return;
         }
 
         LOG_DEBUG("server.authserver", "'{}:{}' User '{}' successfully authenticated", GetRemoteIpAddress().to_string(), GetRemotePort(), _accountInfo.Login);
@@ -522,7 +612,7 @@ bool AuthSession::HandleLogonProof()
         stmt->SetData(3, _os);
         stmt->SetData(4, _accountInfo.Login);
         _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt)
-            .WithPreparedCallback([this, M2 = Acore::Crypto::SRP6::GetSessionVerifier(logonProof->A, logonProof->clientM, _sessionKey)](PreparedQueryResult const&)
+            .WithPreparedCallback([this, M2 = Acore::Crypto::SRP6::GetSessionVerifier(proof->A, proof->ClientM, _sessionKey)](PreparedQueryResult const&)
         {
             // Finish SRP6 and send the final result to the client
             ByteBuffer packet;
@@ -614,8 +704,6 @@ bool AuthSession::HandleLogonProof()
             }
         }
     }
-
-    return true;
 }
 
 bool AuthSession::HandleReconnectChallenge()
@@ -19,6 +19,7 @@
 #define __AUTHSESSION_H__
 
 #include "AsyncCallbackProcessor.h"
+#include "AuthCryptoPool.h"
 #include "BigNumber.h"
 #include "ByteBuffer.h"
 #include "Common.h"
@@ -33,6 +34,7 @@ using boost::asio::ip::tcp;
 
 class Field;
 struct AuthHandler;
+struct LogonProofContext;
 
 enum AuthStatus
 {
@@ -89,6 +91,12 @@ private:
     void LogonChallengeCallback(PreparedQueryResult result);
     void ReconnectChallengeCallback(PreparedQueryResult result);
     void RealmListCallback(PreparedQueryResult result);
+    void LogonProofCallback(std::shared_ptr<LogonProofContext> proof);
+
+    void SendLogonChallengeResult(ByteBuffer& pkt, uint8 securityFlags);
+
+    /// Runs work on the SRP6 worker pool (inline if the pool is disabled), callback is invoked from Update() once it is done
+    bool QueueCryptoWork(std::function<void()>&& work, std::function<void()>&& callback);
 
     bool VerifyVersion(uint8 const* a, int32 aLength, Acore::Crypto::SHA1::Digest const& versionProof, bool isReconnect);
 
@@ -106,6 +114,7 @@ private:
     uint8 _expversion;
 
     QueryCallbackProcessor _queryProcessor;
+    AsyncCallbackProcessor<AuthCryptoCallback> _cryptoProcessor;
 };
 
 #pragma pack(push, 1)
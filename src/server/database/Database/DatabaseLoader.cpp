@@ -41,6 +41,15 @@ namespace
             return CHARACTER_DATABASE_INFO_DEFAULT;
         return EMPTY_DATABASE_INFO;
     }
+    // Group commit is on by default only for the character database and its many small save transactions
+    uint32 GetDefaultGroupCommitMaxBatchSize(std::string_view name)
+    {
+        return name == "Character" ? 32 : 1;
+    }
+    uint32 GetDefaultGroupCommitMaxWait(std::string_view name)
+    {
+        return name == "Character" ? 2 : 0;
+    }
 }
 
 DatabaseLoader::DatabaseLoader(std::string const& logger, uint32 const defaultUpdateMask, std::string_view modulesList)
@@ -75,6 +84,8 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool, std::st
         uint8 const synchThreads = sConfigMgr->GetOption<uint8>(name + "Database.SynchThreads", 1);
 
         pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
+        pool.SetGroupCommit(sConfigMgr->GetOption<uint32>(name + "Database.GroupCommit.MaxBatchSize", GetDefaultGroupCommitMaxBatchSize(name)),
+            Milliseconds(sConfigMgr->GetOption<uint32>(name + "Database.GroupCommit.MaxWait", GetDefaultGroupCommitMaxWait(name))));
 
         if (uint32 error = pool.Open())
         {
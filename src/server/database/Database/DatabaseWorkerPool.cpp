@@ -31,6 +31,7 @@
 #include "SQLOperation.h"
 #include "Transaction.h"
 #include "WorldDatabase.h"
+#include <algorithm>
 #include <limits>
 #include <mysqld_error.h>
 #include <sstream>
@@ -41,6 +42,9 @@
 #include <sstream>
 #endif
 
+/// Query holders are only split over several async connections when every task gets at least this many statements
+#define QUERY_HOLDER_MIN_STATEMENTS_PER_SHARD 8
+
 class PingOperation : public SQLOperation
 {
     //! Operation for idle delaythreads
@@ -55,7 +59,9 @@ template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool() :
     _queue(new ProducerConsumerQueue<SQLOperation*>()),
     _async_threads(0),
-    _synch_threads(0)
+    _synch_threads(0),
+    _groupCommitMaxSize(1),
+    _groupCommitMaxWait(0)
 {
     WPFatal(mysql_thread_safe(), "Used MySQL library isn't thread-safe.");
 
@@ -83,6 +89,13 @@ void DatabaseWorkerPool<T>::SetConnectionInfo(std::string_view infoString, uint8
     _synch_threads = synchThreads;
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::SetGroupCommit(uint32 maxBatchSize, Milliseconds maxWait)
+{
+    _groupCommitMaxSize = std::max<uint32>(maxBatchSize, 1);
+    _groupCommitMaxWait = maxWait;
+}
+
 template <class T>
 uint32 DatabaseWorkerPool<T>::Open()
 {
@@ -236,10 +249,16 @@ QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt)
 template <class T>
 SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder)
 {
-    SQLQueryHolderTask* task = new SQLQueryHolderTask(holder);
+    // Split large holders over the async connections, their statements are independent reads
+    std::size_t shardCount = std::clamp<std::size_t>(holder->GetSize() / QUERY_HOLDER_MIN_STATEMENTS_PER_SHARD, 1, std::max<std::size_t>(_async_threads, 1));
+
+    std::shared_ptr<SQLQueryHolderDispatch> dispatch = std::make_shared<SQLQueryHolderDispatch>(shardCount);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
-    QueryResultHolderFuture result = task->GetFuture();
-    Enqueue(task);
+    QueryResultHolderFuture result = dispatch->Result.get_future();
+
+    for (std::size_t i = 0; i < shardCount; ++i)
+        Enqueue(new SQLQueryHolderTask(holder, dispatch, i, shardCount));
+
     return { std::move(holder), std::move(result) };
 }
 
@@ -269,7 +288,7 @@ void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
     }
 #endif // ACORE_DEBUG
 
-    Enqueue(new TransactionTask(transaction));
+    EnqueueTransaction(new TransactionTask(transaction));
 }
 
 template <class T>
@@ -294,7 +313,7 @@ TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction
 
     TransactionWithResultTask* task = new TransactionWithResultTask(transaction);
     TransactionFuture result = task->GetFuture();
-    Enqueue(task);
+    EnqueueTransaction(task);
     return TransactionCallback(std::move(result));
 }
 
@@ -469,6 +488,43 @@ template <class T>
 void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op)
 {
     _queue->Push(op);
+
+    // Transactions joining the batch now would run before this operation,
+    // close it so its worker stops waiting for more
+    if (_groupCommitMaxSize > 1)
+    {
+        std::lock_guard<std::mutex> lock(_groupCommitLock);
+        if (_openBatch)
+        {
+            _openBatch->Close();
+            _openBatch.reset();
+        }
+    }
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::EnqueueTransaction(TransactionTask* task)
+{
+    if (_groupCommitMaxSize <= 1)
+    {
+        Enqueue(task);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_groupCommitLock);
+
+    if (_openBatch && _openBatch->TryAdd(task))
+        return;
+
+    // Full or already picked up by a worker
+    if (_openBatch)
+        _openBatch->Close();
+
+    _openBatch = std::make_shared<TransactionBatch>(_groupCommitMaxSize);
+    _openBatch->TryAdd(task);
+
+    // Pushed directly, Enqueue would close the batch again
+    _queue->Push(new GroupCommitTask(_openBatch, _groupCommitMaxWait));
 }
 
 template <class T>
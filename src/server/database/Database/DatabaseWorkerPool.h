@@ -20,8 +20,10 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
+#include "Duration.h"
 #include "StringFormat.h"
 #include <array>
+#include <mutex>
 #include <vector>
 
 /** @file DatabaseWorkerPool.h */
@@ -42,6 +44,8 @@ template <typename T>
 class ProducerConsumerQueue;
 
 class SQLOperation;
+class TransactionBatch;
+class TransactionTask;
 struct MySQLConnectionInfo;
 
 template <class T>
@@ -62,6 +66,10 @@ public:
 
     void SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads);
 
+    //! Lets the async workers commit up to maxBatchSize queued transactions as one server side transaction,
+    //! waiting at most maxWait for a batch to fill. A batch size of 1 or less disables group commit.
+    void SetGroupCommit(uint32 maxBatchSize, Milliseconds maxWait);
+
     uint32 Open();
     void Close();
 
@@ -222,6 +230,9 @@ private:
 
     void Enqueue(SQLOperation* op);
 
+    //! Adds the transaction to the open group commit batch, or starts a new one when it is full or closed.
+    void EnqueueTransaction(TransactionTask* task);
+
     //! Gets a free connection in the synchronous connection pool.
     //! Caller MUST call t->Unlock() after touching the MySQL context to prevent deadlocks.
     T* GetFreeConnection();
@@ -234,6 +245,11 @@ private:
     std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
     std::vector<uint8> _preparedStatementSize;
     uint8 _async_threads, _synch_threads;
+
+    uint32 _groupCommitMaxSize;
+    Milliseconds _groupCommitMaxWait;
+    std::mutex _groupCommitLock;
+    std::shared_ptr<TransactionBatch> _openBatch;       //! Batch whose GroupCommitTask is the last queued operation
 #ifdef ACORE_DEBUG
     static inline thread_local bool _warnSyncQueries = false;
 #endif
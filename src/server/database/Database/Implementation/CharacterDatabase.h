@@ -251,13 +251,9 @@ enum CharacterDatabaseStatements : uint32
     CHAR_SEL_CORPSE_LOCATION,
 
     CHAR_SEL_CREATURE_RESPAWNS,
-    CHAR_REP_CREATURE_RESPAWN,
-    CHAR_DEL_CREATURE_RESPAWN,
     CHAR_DEL_CREATURE_RESPAWN_BY_INSTANCE,
 
     CHAR_SEL_GO_RESPAWNS,
-    CHAR_REP_GO_RESPAWN,
-    CHAR_DEL_GO_RESPAWN,
     CHAR_DEL_GO_RESPAWN_BY_INSTANCE,
 
     CHAR_SEL_GM_TICKETS,
@@ -353,6 +349,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_SEL_CHAR_COD_ITEM_MAIL,
     CHAR_SEL_CHAR_SOCIAL,
     CHAR_SEL_CHAR_OLD_CHARS,
+    CHAR_SEL_CHAR_OLD_CHARS_BATCH,
     CHAR_SEL_ARENA_TEAM_ID_BY_PLAYER_GUID,
     CHAR_SEL_MAIL,
     CHAR_SEL_NEXT_MAIL_DELIVERYTIME,
@@ -88,8 +88,6 @@ enum WorldDatabaseStatements : uint32
     WORLD_SEL_WAYPOINT_SCRIPT_BY_ID,
     WORLD_SEL_ITEM_TEMPLATE_BY_NAME,
     WORLD_SEL_CREATURE_BY_ID,
-    WORLD_SEL_GAMEOBJECT_NEAREST,
-    WORLD_SEL_CREATURE_NEAREST,
     WORLD_SEL_GAMEOBJECT_TARGET,
     WORLD_INS_CREATURE,
     WORLD_SEL_GAME_EVENTS,
@@ -30,6 +30,14 @@
 #include <mysql.h>
 #include <mysqld_error.h>
 
+namespace
+{
+    bool IsConnectionLostError(uint32 errNo)
+    {
+        return errNo == CR_SERVER_GONE_ERROR || errNo == CR_SERVER_LOST || errNo == CR_SERVER_LOST_EXTENDED;
+    }
+}
+
 MySQLConnectionInfo::MySQLConnectionInfo(std::string_view infoString)
 {
     std::vector<std::string_view> tokens = Acore::Tokenize(infoString, ';', true);
@@ -50,6 +58,8 @@ MySQLConnectionInfo::MySQLConnectionInfo(std::string_view infoString)
 MySQLConnection::MySQLConnection(MySQLConnectionInfo& connInfo) :
     m_reconnecting(false),
     m_prepareError(false),
+    m_inTransactionBatch(false),
+    m_reconnectCount(0),
     m_Mysql(nullptr),
     m_queue(nullptr),
     m_connectionInfo(connInfo),
@@ -58,6 +68,8 @@ MySQLConnection::MySQLConnection(MySQLConnectionInfo& connInfo) :
 MySQLConnection::MySQLConnection(ProducerConsumerQueue<SQLOperation*>* queue, MySQLConnectionInfo& connInfo) :
     m_reconnecting(false),
     m_prepareError(false),
+    m_inTransactionBatch(false),
+    m_reconnectCount(0),
     m_Mysql(nullptr),
     m_queue(queue),
     m_connectionInfo(connInfo),
@@ -188,7 +200,7 @@ bool MySQLConnection::Execute(std::string_view sql)
             LOG_ERROR("sql.sql", "[{}] {}", lErrno, mysql_error(m_Mysql));
 
             if (_HandleMySQLErrno(lErrno, mysql_error(m_Mysql)))  // If it returns true, an error was handled successfully (i.e. reconnection)
-                return Execute(sql);       // Try again
+                return !m_inTransactionBatch && Execute(sql);       // Try again, unless the batch transaction was lost with the connection
 
             return false;
         }
@@ -199,6 +211,24 @@ bool MySQLConnection::Execute(std::string_view sql)
     return true;
 }
 
+bool MySQLConnection::ExecuteWithoutReconnect(std::string_view sql)
+{
+    if (!m_Mysql)
+        return false;
+
+    uint32 _s = getMSTime();
+
+    if (mysql_query(m_Mysql, std::string(sql).c_str()))
+    {
+        LOG_INFO("sql.sql", "SQL: {}", sql);
+        LOG_ERROR("sql.sql", "[{}] {}", mysql_errno(m_Mysql), mysql_error(m_Mysql));
+        return false;
+    }
+
+    LOG_DEBUG("sql.sql", "[{} ms] SQL: {}", getMSTimeDiff(_s, getMSTime()), sql);
+    return true;
+}
+
 bool MySQLConnection::Execute(PreparedStatementBase* stmt)
 {
     if (!m_Mysql)
@@ -226,7 +256,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
         LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
 
         if (_HandleMySQLErrno(lErrno, mysql_stmt_error(msql_STMT)))  // If it returns true, an error was handled successfully (i.e. reconnection)
-            return Execute(stmt);       // Try again
+            return !m_inTransactionBatch && Execute(stmt);       // Try again, unless the batch transaction was lost with the connection
 
         m_mStmt->ClearParameters();
         return false;
@@ -238,7 +268,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
         LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
 
         if (_HandleMySQLErrno(lErrno, mysql_stmt_error(msql_STMT)))  // If it returns true, an error was handled successfully (i.e. reconnection)
-            return Execute(stmt);       // Try again
+            return !m_inTransactionBatch && Execute(stmt);       // Try again, unless the batch transaction was lost with the connection
 
         m_mStmt->ClearParameters();
         return false;
@@ -381,12 +411,113 @@ void MySQLConnection::CommitTransaction()
 
 int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transaction)
 {
-    std::vector<SQLElementData> const& queries = transaction->m_queries;
-    if (queries.empty())
+    if (transaction->m_queries.empty())
         return -1;
 
     BeginTransaction();
 
+    if (int errorCode = ExecuteTransactionQueries(*transaction))
+    {
+        RollbackTransaction();
+        return errorCode;
+    }
+
+    // we might encounter errors during certain queries, and depending on the kind of error
+    // we might want to restart the transaction. So to prevent data loss, we only clean up when it's all done.
+    // This is done in calling functions DatabaseWorkerPool<T>::DirectCommitTransaction and TransactionTask::Execute,
+    // and not while iterating over every element.
+
+    CommitTransaction();
+    return 0;
+}
+
+int MySQLConnection::ExecuteTransactionBatch(std::vector<std::shared_ptr<TransactionBase>> const& transactions, std::vector<bool>& failed)
+{
+    failed.assign(transactions.size(), false);
+
+    // Nothing was sent yet, the caller can still commit the transactions one by one
+    if (!ExecuteWithoutReconnect("START TRANSACTION"))
+        return GetLastError();
+
+    // The server side transaction does not survive the connection: no statement of the
+    // batch is retried after a reconnect, the batch stops at the first lost connection
+    m_inTransactionBatch = true;
+    uint32 const reconnectCount = m_reconnectCount;
+    int errorCode = 0;
+
+    for (std::size_t i = 0; i < transactions.size(); ++i)
+    {
+        if (transactions[i]->m_queries.empty())
+        {
+            failed[i] = true;
+            continue;
+        }
+
+        if (!ExecuteWithoutReconnect("SAVEPOINT group_commit"))
+        {
+            errorCode = GetLastError();
+            break;
+        }
+
+        int queryError = ExecuteTransactionQueries(*transactions[i]);
+        if (m_reconnectCount != reconnectCount)
+            break;
+
+        if (!queryError)
+            continue;
+
+        // A deadlock rolls back the whole server side transaction and client errors leave
+        // it in an unknown state, only plain query errors can be undone per transaction
+        if (queryError == ER_LOCK_DEADLOCK || queryError >= CR_MIN_ERROR)
+        {
+            errorCode = queryError;
+            break;
+        }
+
+        if (!ExecuteWithoutReconnect("ROLLBACK TO SAVEPOINT group_commit"))
+        {
+            errorCode = GetLastError();
+            break;
+        }
+
+        failed[i] = true;
+    }
+
+    m_inTransactionBatch = false;
+
+    bool const reconnected = m_reconnectCount != reconnectCount;
+    if (!reconnected && !IsConnectionLostError(errorCode))
+    {
+        if (errorCode)
+        {
+            ExecuteWithoutReconnect("ROLLBACK");
+            return errorCode;
+        }
+
+        if (ExecuteWithoutReconnect("COMMIT"))
+            return 0;
+
+        errorCode = GetLastError();
+        if (errorCode == ER_LOCK_DEADLOCK)
+            return errorCode;
+    }
+
+    // The server may have committed before the error (e.g. connection lost while waiting
+    // for the COMMIT reply), and statements may have run on both sides of a reconnect.
+    // Replaying could apply the transactions twice.
+    if (reconnected)
+        LOG_ERROR("sql.sql", "Reconnected during a group commit of {} transactions, outcome unknown. Reporting all of them as failed.", transactions.size());
+    else
+        LOG_ERROR("sql.sql", "Group commit of {} transactions failed with error {}, outcome unknown. Reporting all of them as failed.", transactions.size(), errorCode);
+
+    failed.assign(transactions.size(), true);
+    return 0;
+}
+
+int MySQLConnection::ExecuteTransactionQueries(TransactionBase const& transaction)
+{
+    std::vector<SQLElementData> const& queries = transaction.m_queries;
+
     for (auto const& data : queries)
     {
         switch (data.type)
@@ -410,9 +541,7 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
                 if (!Execute(stmt))
                 {
                     LOG_WARN("sql.sql", "Transaction aborted. {} queries not executed.", queries.size());
-                    int errorCode = GetLastError();
-                    RollbackTransaction();
-                    return errorCode;
+                    return GetLastError();
                 }
             }
             break;
@@ -435,21 +564,13 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
                 if (!Execute(sql))
                 {
                     LOG_WARN("sql.sql", "Transaction aborted. {} queries not executed.", queries.size());
-                    uint32 errorCode = GetLastError();
-                    RollbackTransaction();
-                    return errorCode;
+                    return GetLastError();
                 }
             }
             break;
         }
     }
 
-    // we might encounter errors during certain queries, and depending on the kind of error
-    // we might want to restart the transaction. So to prevent data loss, we only clean up when it's all done.
-    // This is done in calling functions DatabaseWorkerPool<T>::DirectCommitTransaction and TransactionTask::Execute,
-    // and not while iterating over every element.
-
-    CommitTransaction();
     return 0;
 }
 
@@ -593,6 +714,7 @@ bool MySQLConnection::_HandleMySQLErrno(uint32 errNo, char const* err, uint8 att
                         (m_connectionFlags & CONNECTION_ASYNC) ? "asynchronous" : "synchronous");
 
                 m_reconnecting = false;
+                ++m_reconnectCount;
                 return true;
             }
 
@@ -79,6 +79,12 @@ public:
     void RollbackTransaction();
     void CommitTransaction();
     int ExecuteTransaction(std::shared_ptr<TransactionBase> transaction);
+    //! Runs the transactions as one server side transaction, each behind its own savepoint.
+    //! Transactions failing on a query error are rolled back to their savepoint and flagged in failed.
+    //! Returns the error code when the whole batch is known to be rolled back instead.
+    //! A failed COMMIT or a lost connection leaves the outcome unknown: returns 0 and flags
+    //! every transaction as failed, nothing of the batch is retried on a new connection.
+    int ExecuteTransactionBatch(std::vector<std::shared_ptr<TransactionBase>> const& transactions, std::vector<bool>& failed);
     std::size_t EscapeString(char* to, char const* from, std::size_t length);
     void Ping();
 
@@ -100,11 +106,18 @@ protected:
     virtual void DoPrepareStatements() = 0;
     virtual bool _HandleMySQLErrno(uint32 errNo, char const* err = "", uint8 attempts = 5);
 
+    //! Executes the queries of the transaction inside an already started server side transaction
+    int ExecuteTransactionQueries(TransactionBase const& transaction);
+    //! Executes the statement once, a lost connection is reported instead of reconnecting
+    bool ExecuteWithoutReconnect(std::string_view sql);
+
     typedef std::vector<std::unique_ptr<MySQLPreparedStatement>> PreparedStatementContainer;
 
     PreparedStatementContainer m_stmts; //! PreparedStatements storage
     bool m_reconnecting;  //! Are we reconnecting?
     bool m_prepareError;  //! Was there any error while preparing statements?
+    bool m_inTransactionBatch; //! Is a group commit batch running? Statements are not retried after a reconnect then.
+    uint32 m_reconnectCount;   //! Successful reconnects, lets a batch notice it lost its server side transaction
     MySQLHandle* m_Mysql; //! MySQL Handle.
 
 private:
@@ -70,18 +70,41 @@ void SQLQueryHolderBase::SetSize(std::size_t size)
 {
     /// to optimize push_back, reserve the number of queries about to be executed
     m_queries.resize(size);
+    m_queryTimes.resize(size, Microseconds::zero());
 }
 
+Microseconds SQLQueryHolderBase::GetQueryTime(std::size_t index) const
+{
+    if (index < m_queryTimes.size())
+        return m_queryTimes[index];
+
+    return Microseconds::zero();
+}
+
+SQLQueryHolderDispatch::SQLQueryHolderDispatch(std::size_t shardCount)
+    : PendingShards(shardCount), DispatchTime(std::chrono::steady_clock::now()) { }
+
 SQLQueryHolderTask::~SQLQueryHolderTask() = default;
 
 bool SQLQueryHolderTask::Execute()
 {
-    /// execute all queries in the holder and pass the results
-    for (std::size_t i = 0; i < m_holder->m_queries.size(); ++i)
+    /// execute this shard's queries and pass the results, shards only touch their own slots
+    for (std::size_t i = m_shardIndex; i < m_holder->m_queries.size(); i += m_shardCount)
+    {
         if (PreparedStatementBase* stmt = m_holder->m_queries[i].first)
+        {
+            auto start = std::chrono::steady_clock::now();
             m_holder->SetPreparedResult(i, m_conn->Query(stmt));
+            m_holder->m_queryTimes[i] = std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start);
+        }
+    }
+
+    if (m_dispatch->PendingShards.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        m_holder->m_executionTime = std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - m_dispatch->DispatchTime);
+        m_dispatch->Result.set_value();
+    }
 
-    m_result.set_value();
     return true;
 }
 
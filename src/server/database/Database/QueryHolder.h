@@ -18,7 +18,9 @@
 #ifndef _QUERYHOLDER_H
 #define _QUERYHOLDER_H
 
+#include "Duration.h"
 #include "SQLOperation.h"
+#include <atomic>
 #include <vector>
 
 class AC_DATABASE_API SQLQueryHolderBase
@@ -29,14 +31,22 @@ public:
     SQLQueryHolderBase() = default;
     virtual ~SQLQueryHolderBase();
     void SetSize(std::size_t size);
+    [[nodiscard]] std::size_t GetSize() const { return m_queries.size(); }
     PreparedQueryResult GetPreparedResult(std::size_t index) const;
     void SetPreparedResult(std::size_t index, PreparedResultSet* result);
 
+    /// Time spent executing the statement at index, zero if it was not executed
+    [[nodiscard]] Microseconds GetQueryTime(std::size_t index) const;
+    /// Wall time from dispatching the holder until its last statement finished
+    [[nodiscard]] Microseconds GetExecutionTime() const { return m_executionTime; }
+
 protected:
     bool SetPreparedQueryImpl(std::size_t index, PreparedStatementBase* stmt);
 
 private:
     std::vector<std::pair<PreparedStatementBase*, PreparedQueryResult>> m_queries;
+    std::vector<Microseconds> m_queryTimes;
+    Microseconds m_executionTime{0};
 };
 
 template<typename T>
@@ -49,20 +59,34 @@ public:
     }
 };
 
+/// State shared by all tasks a query holder was split into, the last one to finish fulfills the promise
+struct AC_DATABASE_API SQLQueryHolderDispatch
+{
+    explicit SQLQueryHolderDispatch(std::size_t shardCount);
+
+    std::atomic<std::size_t> PendingShards;
+    std::chrono::steady_clock::time_point DispatchTime;
+    QueryResultHolderPromise Result;
+};
+
+/// Executes every shardCount-th statement of a holder starting at shardIndex, so independent
+/// statements of a single holder can run on several async connections at the same time
 class AC_DATABASE_API SQLQueryHolderTask : public SQLOperation
 {
 public:
-    explicit SQLQueryHolderTask(std::shared_ptr<SQLQueryHolderBase> holder)
-        : m_holder(std::move(holder)) { }
+    SQLQueryHolderTask(std::shared_ptr<SQLQueryHolderBase> holder, std::shared_ptr<SQLQueryHolderDispatch> dispatch,
+        std::size_t shardIndex = 0, std::size_t shardCount = 1)
+        : m_holder(std::move(holder)), m_dispatch(std::move(dispatch)), m_shardIndex(shardIndex), m_shardCount(shardCount) { }
 
     ~SQLQueryHolderTask();
 
     bool Execute() override;
-    QueryResultHolderFuture GetFuture() { return m_result.get_future(); }
 
 private:
     std::shared_ptr<SQLQueryHolderBase> m_holder;
-    QueryResultHolderPromise m_result;
+    std::shared_ptr<SQLQueryHolderDispatch> m_dispatch;
+    std::size_t m_shardIndex;
+    std::size_t m_shardCount;
 };
 
 class AC_DATABASE_API SQLQueryHolderCallback
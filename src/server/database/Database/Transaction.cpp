@@ -21,6 +21,7 @@
 #include "MySQLConnection.h"
 #include "PreparedStatement.h"
 #include "Timer.h"
+#include <algorithm>
 #include <mysqld_error.h>
 #include <sstream>
 #include <thread>
@@ -138,6 +139,12 @@ void TransactionTask::CleanupOnFailure()
     m_trans->Cleanup();
 }
 
+void TransactionTask::FinishGroupCommit(bool success)
+{
+    if (!success)
+        CleanupOnFailure();
+}
+
 bool TransactionWithResultTask::Execute()
 {
     int errorCode = TryExecute();
@@ -179,6 +186,96 @@ bool TransactionWithResultTask::Execute()
     return false;
 }
 
+void TransactionWithResultTask::FinishGroupCommit(bool success)
+{
+    TransactionTask::FinishGroupCommit(success);
+    m_result.set_value(success);
+}
+
+bool TransactionBatch::TryAdd(TransactionTask* task)
+{
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if (_closed || _tasks.size() >= _maxSize)
+            return false;
+
+        _tasks.push_back(task);
+        if (_tasks.size() < _maxSize)
+            return true;
+    }
+
+    _condition.notify_one();
+    return true;
+}
+
+void TransactionBatch::Close()
+{
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _closed = true;
+    }
+
+    _condition.notify_one();
+}
+
+std::vector<TransactionTask*> TransactionBatch::Seal(Milliseconds maxWait)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    if (maxWait > 0ms)
+        _condition.wait_for(lock, maxWait, [this] { return _closed || _tasks.size() >= _maxSize; });
+
+    _closed = true;
+    return std::move(_tasks);
+}
+
+GroupCommitTask::~GroupCommitTask()
+{
+    // Never executed (queue cancelled), the batch still owns its tasks
+    for (TransactionTask* task : m_batch->Seal(0ms))
+        delete task;
+}
+
+bool GroupCommitTask::Execute()
+{
+    std::vector<TransactionTask*> tasks = m_batch->Seal(m_maxWait);
+    if (tasks.empty())
+        return true;
+
+    std::vector<std::shared_ptr<TransactionBase>> transactions;
+    transactions.reserve(tasks.size());
+    for (TransactionTask* task : tasks)
+        transactions.push_back(task->m_trans);
+
+    // A lone transaction is committed the usual way
+    std::vector<bool> failed;
+    int errorCode = -1;
+    if (tasks.size() > 1)
+    {
+        errorCode = m_conn->ExecuteTransactionBatch(transactions, failed);
+        if (errorCode)
+            LOG_WARN("sql.sql", "Group commit of {} transactions rolled back (error {}), committing them one by one.", tasks.size(), errorCode);
+        else
+            LOG_DEBUG("sql.driver", "Group commit of {} transactions, {} failed.", tasks.size(), std::count(failed.begin(), failed.end(), true));
+    }
+
+    for (std::size_t i = 0; i < tasks.size(); ++i)
+    {
+        TransactionTask* task = tasks[i];
+        if (errorCode)
+        {
+            // Nothing of the batch was applied, runs with the usual deadlock handling
+            task->SetConnection(m_conn);
+            task->Execute();
+        }
+        else
+            task->FinishGroupCommit(!failed[i]);
+
+        delete task;
+    }
+
+    return true;
+}
+
 bool TransactionCallback::InvokeIfReady()
 {
     if (m_future.valid() && m_future.wait_for(0s) == std::future_status::ready)
@@ -20,8 +20,10 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
+#include "Duration.h"
 #include "SQLOperation.h"
 #include "StringFormat.h"
+#include <condition_variable>
 #include <functional>
 #include <mutex>
 #include <vector>
@@ -78,6 +80,7 @@ class AC_DATABASE_API TransactionTask : public SQLOperation
 
     friend class DatabaseWorker;
     friend class TransactionCallback;
+    friend class GroupCommitTask;
 
 public:
     TransactionTask(std::shared_ptr<TransactionBase> trans) : m_trans(std::move(trans)) { }
@@ -87,6 +90,8 @@ protected:
     bool Execute() override;
     int TryExecute();
     void CleanupOnFailure();
+    //- Called once the group commit holding this transaction is done
+    virtual void FinishGroupCommit(bool success);
 
     std::shared_ptr<TransactionBase> m_trans;
     static std::mutex _deadlockLock;
@@ -101,10 +106,49 @@ public:
 
 protected:
     bool Execute() override;
+    void FinishGroupCommit(bool success) override;
 
     TransactionPromise m_result;
 };
 
+//- Transactions waiting to be committed together by a GroupCommitTask
+class AC_DATABASE_API TransactionBatch
+{
+public:
+    explicit TransactionBatch(std::size_t maxSize) : _maxSize(maxSize) { }
+
+    //- Takes ownership of the task, fails once the batch is full, closed or sealed
+    bool TryAdd(TransactionTask* task);
+    //- Refuses further tasks and wakes up a worker waiting in Seal
+    void Close();
+    //- Waits up to maxWait for the batch to fill or be closed, then hands out its tasks
+    std::vector<TransactionTask*> Seal(Milliseconds maxWait);
+
+private:
+    std::mutex _lock;
+    std::condition_variable _condition;
+    std::vector<TransactionTask*> _tasks;
+    std::size_t _maxSize;
+    bool _closed{false};
+};
+
+//- Commits a batch of transactions from different callers as one server side transaction.
+//- A transaction failing on a query error only rolls back itself, a deadlock makes every
+//- transaction of the batch run again on its own. A failed commit or a lost connection
+//- leaves the outcome unknown and fails every transaction of the batch.
+class AC_DATABASE_API GroupCommitTask : public SQLOperation
+{
+public:
+    GroupCommitTask(std::shared_ptr<TransactionBatch> batch, Milliseconds maxWait) : m_batch(std::move(batch)), m_maxWait(maxWait) { }
+    ~GroupCommitTask() override;
+
+protected:
+    bool Execute() override;
+
+    std::shared_ptr<TransactionBatch> m_batch;
+    Milliseconds m_maxWait;
+};
+
 class AC_DATABASE_API TransactionCallback
 {
 public:
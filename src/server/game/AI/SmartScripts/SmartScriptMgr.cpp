@@ -26,6 +26,8 @@
 #include "ObjectMgr.h"
 #include "ScriptedCreature.h"
 #include "SpellMgr.h"
+#include <algorithm>
+#include <unordered_set>
 
 bool SmartAIMgr::IsSAIBoolValid(SmartScriptHolder const& e, SAIBool value)
 {
@@ -118,20 +120,68 @@ void SmartAIMgr::LoadSmartAIFromDB()
 {
     uint32 oldMSTime = getMSTime();
 
-    for (uint8 i = 0; i < SMART_SCRIPT_TYPE_MAX; i++)
-        mEventMap[i].clear();  //Drop Existing SmartAI List
-
-    WorldDatabasePreparedStatement* stmt = WorldDatabase.GetPreparedStatement(WORLD_SEL_SMART_SCRIPTS);
-    PreparedQueryResult result = WorldDatabase.Query(stmt);
+    uint32 count = 0;
+    SmartAISpawnSnapshot spawns = SnapshotSpawns();
+    mEventMap = LoadSmartAIEventStore(spawns, count);
 
-    if (!result)
+    if (!count)
     {
         LOG_WARN("server.loading", ">> Loaded 0 SmartAI scripts. DB table `smart_scripts` is empty.");
         LOG_INFO("server.loading", " ");
         return;
     }
 
-    uint32 count = 0;
+    CheckIfSmartAIInDatabaseExists(mEventMap, spawns);
+
+    LOG_INFO("server.loading", ">> Loaded {} SmartAI scripts in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
+    LOG_INFO("server.loading", " ");
+}
+
+void SmartAISpawnSnapshot::Sort()
+{
+    std::sort(Creatures.begin(), Creatures.end());
+    std::sort(GameObjects.begin(), GameObjects.end());
+}
+
+/*static*/ uint32 SmartAISpawnSnapshot::FindEntry(SpawnEntryList const& spawns, ObjectGuid::LowType spawnId)
+{
+    auto itr = std::lower_bound(spawns.begin(), spawns.end(), spawnId, [](std::pair<ObjectGuid::LowType, uint32> const& spawn, ObjectGuid::LowType id)
+    {
+        return spawn.first < id;
+    });
+
+    return itr != spawns.end() && itr->first == spawnId ? itr->second : 0;
+}
+
+/*static*/ SmartAISpawnSnapshot SmartAIMgr::SnapshotSpawns()
+{
+    SmartAISpawnSnapshot spawns;
+
+    CreatureDataContainer const& creatures = sObjectMgr->GetAllCreatureData();
+    spawns.Creatures.reserve(creatures.size());
+    for (auto const& [spawnId, data] : creatures)
+        spawns.Creatures.emplace_back(spawnId, data.id);
+
+    GameObjectDataContainer const& gameObjects = sObjectMgr->GetAllGOData();
+    spawns.GameObjects.reserve(gameObjects.size());
+    for (auto const& [spawnId, data] : gameObjects)
+        spawns.GameObjects.emplace_back(spawnId, data.id);
+
+    return spawns;
+}
+
+SmartAIEventStore SmartAIMgr::LoadSmartAIEventStore(SmartAISpawnSnapshot& spawns, uint32& count)
+{
+    SmartAIEventStore store;
+    count = 0;
+
+    spawns.Sort();
+
+    WorldDatabasePreparedStatement* stmt = WorldDatabase.GetPreparedStatement(WORLD_SEL_SMART_SCRIPTS);
+    PreparedQueryResult result = WorldDatabase.Query(stmt);
+
+    if (!result)
+        return store;
 
     do
     {
@@ -196,7 +246,7 @@ void SmartAIMgr::LoadSmartAIFromDB()
             {
                 case SMART_SCRIPT_TYPE_CREATURE:
                     {
-                        if (!sObjectMgr->GetCreatureData(uint32(std::abs(temp.entryOrGuid))))
+                        if (!spawns.GetCreatureEntry(uint32(std::abs(temp.entryOrGuid))))
                         {
                             LOG_ERROR("sql.sql", "SmartAIMgr::LoadSmartAIFromDB: Creature guid ({}) does not exist, skipped loading.", uint32(std::abs(temp.entryOrGuid)));
                             continue;
@@ -205,7 +255,7 @@ void SmartAIMgr::LoadSmartAIFromDB()
                     }
                 case SMART_SCRIPT_TYPE_GAMEOBJECT:
                     {
-                        if (!sObjectMgr->GetGameObjectData(uint32(std::abs(temp.entryOrGuid))))
+                        if (!spawns.GetGameObjectEntry(uint32(std::abs(temp.entryOrGuid))))
                         {
                             LOG_ERROR("sql.sql", "SmartAIMgr::LoadSmartAIFromDB: GameObject guid ({}) does not exist, skipped loading.", uint32(temp.entryOrGuid));
                             continue;
@@ -256,7 +306,7 @@ void SmartAIMgr::LoadSmartAIFromDB()
             continue;
 
         // check all event and action params
-        if (!IsEventValid(temp))
+        if (!IsEventValid(temp, spawns))
             continue;
 
         // xinef: specific check for timed events, fix db makers
@@ -302,50 +352,100 @@ void SmartAIMgr::LoadSmartAIFromDB()
                 temp.target.type = SMART_TARGET_POSITION;
 
         // creature entry / guid not found in storage, create empty event list for it and increase counters
-        if (mEventMap[source_type].find(temp.entryOrGuid) == mEventMap[source_type].end())
-        {
+        auto [itr, inserted] = store[source_type].try_emplace(temp.entryOrGuid);
+        if (inserted)
             ++count;
-            SmartAIEventList eventList;
-            mEventMap[source_type][temp.entryOrGuid] = eventList;
-        }
+
         // store the new event
-        mEventMap[source_type][temp.entryOrGuid].push_back(temp);
+        itr->second.push_back(temp);
     } while (result->NextRow());
 
-    CheckIfSmartAIInDatabaseExists();
+    return store;
+}
 
-    LOG_INFO("server.loading", ">> Loaded {} SmartAI scripts in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
-    LOG_INFO("server.loading", " ");
+static bool IsSameSmartEvent(SmartScriptHolder const& a, SmartScriptHolder const& b)
+{
+    return a.entryOrGuid == b.entryOrGuid && a.source_type == b.source_type && a.event_id == b.event_id && a.link == b.link
+        && a.event.type == b.event.type && a.event.event_phase_mask == b.event.event_phase_mask && a.event.event_chance == b.event.event_chance
+        && a.event.event_flags == b.event.event_flags
+        && a.event.raw.param1 == b.event.raw.param1 && a.event.raw.param2 == b.event.raw.param2 && a.event.raw.param3 == b.event.raw.param3
+        && a.event.raw.param4 == b.event.raw.param4 && a.event.raw.param5 == b.event.raw.param5 && a.event.raw.param6 == b.event.raw.param6
+        && a.action.type == b.action.type
+        && a.action.raw.param1 == b.action.raw.param1 && a.action.raw.param2 == b.action.raw.param2 && a.action.raw.param3 == b.action.raw.param3
+        && a.action.raw.param4 == b.action.raw.param4 && a.action.raw.param5 == b.action.raw.param5 && a.action.raw.param6 == b.action.raw.param6
+        && a.target.type == b.target.type
+        && a.target.raw.param1 == b.target.raw.param1 && a.target.raw.param2 == b.target.raw.param2 && a.target.raw.param3 == b.target.raw.param3
+        && a.target.raw.param4 == b.target.raw.param4
+        && a.target.x == b.target.x && a.target.y == b.target.y && a.target.z == b.target.z && a.target.o == b.target.o;
 }
 
-void SmartAIMgr::CheckIfSmartAIInDatabaseExists()
+uint32 SmartAIMgr::ApplySmartAIEventStore(SmartAIEventStore&& store)
 {
-    // SMART_SCRIPT_TYPE_CREATURE
-    for (auto const& [entry, creatureTemplate] : *sObjectMgr->GetCreatureTemplates())
+    uint32 changed = 0;
+
+    for (uint8 i = 0; i < SMART_SCRIPT_TYPE_MAX; ++i)
     {
-        if (creatureTemplate.AIName != "SmartAI")
-            continue;
+        SmartAIEventMap& current = mEventMap[i];
+        SmartAIEventMap& loaded = store[i];
 
-        bool found = false;
+        for (auto itr = current.begin(); itr != current.end();)
+        {
+            if (loaded.find(itr->first) == loaded.end())
+            {
+                itr = current.erase(itr);
+                ++changed;
+            }
+            else
+                ++itr;
+        }
 
-        // check template SAI
-        if (mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_CREATURE)].find(creatureTemplate.Entry) != mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_CREATURE)].end())
-            found = true;
-        else
+        for (auto& [entryOrGuid, events] : loaded)
         {
-            // check GUID SAI
-            for (auto const& pair : sObjectMgr->GetAllCreatureData())
+            auto itr = current.find(entryOrGuid);
+            if (itr == current.end())
             {
-                if (pair.second.id != creatureTemplate.Entry)
-                    continue;
+                current.emplace(entryOrGuid, std::move(events));
+                ++changed;
+                continue;
+            }
 
-                if (mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_CREATURE)].find((-1) * pair.first) != mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_CREATURE)].end())
-                {
-                    found = true;
-                    break;
-                }
+            if (!std::equal(itr->second.begin(), itr->second.end(), events.begin(), events.end(), IsSameSmartEvent))
+            {
+                itr->second = std::move(events);
+                ++changed;
             }
         }
+    }
+
+    return changed;
+}
+
+void SmartAIMgr::CheckIfSmartAIInDatabaseExists(SmartAIEventStore const& store, SmartAISpawnSnapshot const& spawns) const
+{
+    SmartAIEventMap const& creatureScripts = store[uint32(SmartScriptType::SMART_SCRIPT_TYPE_CREATURE)];
+    SmartAIEventMap const& gameobjectScripts = store[uint32(SmartScriptType::SMART_SCRIPT_TYPE_GAMEOBJECT)];
+
+    // entries with at least one spawn that has GUID SAI, collected once instead of scanning all spawns per template
+    std::unordered_set<uint32> creatureGuidScripts;
+    for (auto const& [entryOrGuid, events] : creatureScripts)
+        if (entryOrGuid < 0)
+            if (uint32 spawnEntry = spawns.GetCreatureEntry(ObjectGuid::LowType(-entryOrGuid)))
+                creatureGuidScripts.insert(spawnEntry);
+
+    std::unordered_set<uint32> gameobjectGuidScripts;
+    for (auto const& [entryOrGuid, events] : gameobjectScripts)
+        if (entryOrGuid < 0)
+            if (uint32 spawnEntry = spawns.GetGameObjectEntry(ObjectGuid::LowType(-entryOrGuid)))
+                gameobjectGuidScripts.insert(spawnEntry);
+
+    // SMART_SCRIPT_TYPE_CREATURE
+    for (auto const& [entry, creatureTemplate] : *sObjectMgr->GetCreatureTemplates())
+    {
+        if (creatureTemplate.AIName != "SmartAI")
+            continue;
+
+        // check template SAI, then GUID SAI
+        bool found = creatureScripts.find(creatureTemplate.Entry) != creatureScripts.end() || creatureGuidScripts.count(creatureTemplate.Entry);
 
         if (!found)
             LOG_ERROR("sql.sql", "Creature entry ({}) has SmartAI enabled but no SmartAI entries in the database.", creatureTemplate.Entry);
@@ -357,26 +457,8 @@ void SmartAIMgr::CheckIfSmartAIInDatabaseExists()
         if (gameobjectTemplate.AIName != "SmartGameObjectAI")
             continue;
 
-        bool found = false;
-
-        // check template SAI
-        if (mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_GAMEOBJECT)].find(gameobjectTemplate.entry) != mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_GAMEOBJECT)].end())
-            found = true;
-        else
-        {
-            // check GUID SAI
-            for (auto const& pair : sObjectMgr->GetAllGOData())
-            {
-                if (pair.second.id != gameobjectTemplate.entry)
-                    continue;
-
-                if (mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_GAMEOBJECT)].find((-1) * pair.first) != mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_GAMEOBJECT)].end())
-                {
-                    found = true;
-                    break;
-                }
-            }
-        }
+        // check template SAI, then GUID SAI
+        bool found = gameobjectScripts.find(gameobjectTemplate.entry) != gameobjectScripts.end() || gameobjectGuidScripts.count(gameobjectTemplate.entry);
 
         if (!found)
             LOG_ERROR("sql.sql", "Gameobject entry ({}) has SmartGameobjectAI enabled but no SmartAI entries in the database.", gameobjectTemplate.entry);
@@ -390,7 +472,7 @@ void SmartAIMgr::CheckIfSmartAIInDatabaseExists()
         if (pair.second != scriptID)
             continue;
 
-        if (mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_AREATRIGGER)].find(pair.first) == mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_AREATRIGGER)].end())
+        if (store[uint32(SmartScriptType::SMART_SCRIPT_TYPE_AREATRIGGER)].find(pair.first) == store[uint32(SmartScriptType::SMART_SCRIPT_TYPE_AREATRIGGER)].end())
             LOG_ERROR("sql.sql", "AreaTrigger entry ({}) has SmartTrigger enabled but no SmartAI entries in the database.", pair.first);
     }
 }
@@ -1008,7 +1090,7 @@ bool SmartAIMgr::CheckUnusedTargetParams(SmartScriptHolder const& e)
     return valid;
 }
 
-bool SmartAIMgr::IsEventValid(SmartScriptHolder& e)
+bool SmartAIMgr::IsEventValid(SmartScriptHolder& e, SmartAISpawnSnapshot const& spawns)
 {
     if ((e.event.type >= SMART_EVENT_TC_END && e.event.type <= SMART_EVENT_AC_START) || e.event.type >= SMART_EVENT_AC_END)
     {
@@ -1395,7 +1477,7 @@ bool SmartAIMgr::IsEventValid(SmartScriptHolder& e)
                     return false;
                 }
 
-                if (e.event.distance.guid != 0 && !sObjectMgr->GetCreatureData(e.event.distance.guid))
+                if (e.event.distance.guid != 0 && !spawns.GetCreatureEntry(e.event.distance.guid))
                 {
                     LOG_ERROR("sql.sql", "SmartAIMgr: Event SMART_EVENT_DISTANCE_CREATURE using invalid creature guid {}, skipped.", e.event.distance.guid);
                     return false;
@@ -1420,7 +1502,7 @@ bool SmartAIMgr::IsEventValid(SmartScriptHolder& e)
                     return false;
                 }
 
-                if (e.event.distance.guid != 0 && !sObjectMgr->GetGameObjectData(e.event.distance.guid))
+                if (e.event.distance.guid != 0 && !spawns.GetGameObjectEntry(e.event.distance.guid))
                 {
                     LOG_ERROR("sql.sql", "SmartAIMgr: Event SMART_EVENT_DISTANCE_GAMEOBJECT using invalid gameobject guid {}, skipped.", e.event.distance.guid);
                     return false;
@@ -1988,11 +2070,11 @@ bool SmartAIMgr::IsEventValid(SmartScriptHolder& e)
         case SMART_ACTION_LOAD_EQUIPMENT:
             return IsSAIBoolValid(e, e.action.loadEquipment.force);
         case SMART_ACTION_TALK:
-            if (!IsTextValid(e, e.action.talk.textGroupID))
+            if (!IsTextValid(e, e.action.talk.textGroupID, spawns))
                 return false;
             return IsSAIBoolValid(e, e.action.talk.useTalkTarget);
         case SMART_ACTION_SIMPLE_TALK:
-            if (!IsTextValid(e, e.action.simpleTalk.textGroupID))
+            if (!IsTextValid(e, e.action.simpleTalk.textGroupID, spawns))
                 return false;
             break;
         case SMART_ACTION_SET_HEALTH_REGEN:
@@ -2114,7 +2196,7 @@ bool SmartAIMgr::IsEventValid(SmartScriptHolder& e)
     return true;
 }
 
-bool SmartAIMgr::IsTextValid(SmartScriptHolder const& e, uint32 id)
+bool SmartAIMgr::IsTextValid(SmartScriptHolder const& e, uint32 id, SmartAISpawnSnapshot const& spawns)
 {
     if (e.GetScriptType() != SMART_SCRIPT_TYPE_CREATURE)
         return true;
@@ -2137,14 +2219,12 @@ bool SmartAIMgr::IsTextValid(SmartScriptHolder const& e, uint32 id)
                 if (e.entryOrGuid < 0)
                 {
                     ObjectGuid::LowType guid = ObjectGuid::LowType(-e.entryOrGuid);
-                    CreatureData const* data = sObjectMgr->GetCreatureData(guid);
-                    if (!data)
+                    entry = spawns.GetCreatureEntry(guid);
+                    if (!entry)
                     {
                         LOG_ERROR("sql.sql", "SmartAIMgr: Entry {} SourceType {} Event {} Action {} using non-existent Creature guid {}, skipped.", e.entryOrGuid, e.GetScriptType(), e.event_id, e.GetActionType(), guid);
                         return false;
                     }
-                    else
-                        entry = data->id;
                 }
                 else
                     entry = uint32(e.entryOrGuid);
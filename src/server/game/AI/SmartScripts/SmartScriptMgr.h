@@ -25,6 +25,7 @@
 #include "ObjectMgr.h"
 #include "Optional.h"
 #include "SpellMgr.h"
+#include <array>
 #include <limits>
 #include "WaypointMgr.h"
 
@@ -2105,6 +2106,28 @@ typedef std::list<SmartScriptHolder> SmartAIEventStoredList;
 
 // all events for all entries / guids
 typedef std::unordered_map<int32, SmartAIEventList> SmartAIEventMap;
+typedef std::array<SmartAIEventMap, SMART_SCRIPT_TYPE_MAX> SmartAIEventStore;
+
+// spawn id -> entry of all creature and gameobject spawns, copied on the world thread so a load
+// running off it never reads the spawn stores that map updates and GM commands modify
+class SmartAISpawnSnapshot
+{
+public:
+    typedef std::vector<std::pair<ObjectGuid::LowType, uint32>> SpawnEntryList;
+
+    SpawnEntryList Creatures;
+    SpawnEntryList GameObjects;
+
+    // must be called before the lookups, kept apart so the sort can run off the world thread
+    void Sort();
+
+    // 0 if the spawn does not exist
+    [[nodiscard]] uint32 GetCreatureEntry(ObjectGuid::LowType spawnId) const { return FindEntry(Creatures, spawnId); }
+    [[nodiscard]] uint32 GetGameObjectEntry(ObjectGuid::LowType spawnId) const { return FindEntry(GameObjects, spawnId); }
+
+private:
+    static uint32 FindEntry(SpawnEntryList const& spawns, ObjectGuid::LowType spawnId);
+};
 
 class SmartAIMgr
 {
@@ -2115,7 +2138,14 @@ public:
     static SmartAIMgr* instance();
 
     void LoadSmartAIFromDB();
-    void CheckIfSmartAIInDatabaseExists();
+    void CheckIfSmartAIInDatabaseExists(SmartAIEventStore const& store, SmartAISpawnSnapshot const& spawns) const;
+
+    // Copies the spawn data used to validate guid scripts, must be called on the world thread
+    static SmartAISpawnSnapshot SnapshotSpawns();
+    // Queries and validates `smart_scripts` without touching the live store or spawn data, safe to call off the world thread
+    SmartAIEventStore LoadSmartAIEventStore(SmartAISpawnSnapshot& spawns, uint32& count);
+    // Replaces only the entries whose event lists differ from the live store, returns the number of changed entries
+    uint32 ApplySmartAIEventStore(SmartAIEventStore&& store);
 
     SmartAIEventList GetScript(int32 entry, SmartScriptType type)
     {
@@ -2132,11 +2162,11 @@ public:
 
 private:
     //event stores
-    SmartAIEventMap mEventMap[SMART_SCRIPT_TYPE_MAX];
+    SmartAIEventStore mEventMap;
 
     static bool EventHasInvoker(SMART_EVENT event);
 
-    bool IsEventValid(SmartScriptHolder& e);
+    bool IsEventValid(SmartScriptHolder& e, SmartAISpawnSnapshot const& spawns);
     bool IsTargetValid(SmartScriptHolder const& e);
 
     /*inline bool IsTargetValid(SmartScriptHolder e, int32 target)
@@ -2270,7 +2300,7 @@ private:
     }
 
     static bool IsSAIBoolValid(SmartScriptHolder const& e, SAIBool value);
-    static bool IsTextValid(SmartScriptHolder const& e, uint32 id);
+    static bool IsTextValid(SmartScriptHolder const& e, uint32 id, SmartAISpawnSnapshot const& spawns);
     static bool CheckUnusedEventParams(SmartScriptHolder const& e);
     static bool CheckUnusedActionParams(SmartScriptHolder const& e);
     static bool CheckUnusedTargetParams(SmartScriptHolder const& e);
@@ -510,6 +510,7 @@ void AchievementMgr::Reset()
 
     _completedAchievements.clear();
     _criteriaProgress.clear();
+    _completedCriteria.clear();
     DeleteFromDB(_player->GetGUID().GetCounter());
 
     // re-fill data
@@ -897,6 +898,9 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
     for (AchievementCriteriaEntryList::const_iterator i = achievementCriteriaList->begin(); i != achievementCriteriaList->end(); ++i)
     {
         AchievementCriteriaEntry const* achievementCriteria = (*i);
+        if (IsCriteriaKnownCompleted(achievementCriteria->ID))
+            continue;
+
         AchievementEntry const* achievement = sAchievementStore.LookupEntry(achievementCriteria->referredAchievement);
         if (!achievement)
             continue;
@@ -2188,6 +2192,8 @@ void AchievementMgr::SetCriteriaProgress(AchievementCriteriaEntry const* entry,
 
 void AchievementMgr::RemoveCriteriaProgress(AchievementCriteriaEntry const* entry)
 {
+    SetCriteriaKnownCompleted(entry->ID, false);
+
     CriteriaProgressMap::iterator criteriaProgress = _criteriaProgress.find(entry->ID);
     if (criteriaProgress == _criteriaProgress.end())
         return;
@@ -2488,11 +2494,30 @@ bool AchievementMgr::CanUpdateCriteria(AchievementCriteriaEntry const* criteria,
 
     // don't update already completed criteria
     if (IsCompletedCriteria(criteria, achievement))
+    {
+        // realm firsts may reopen or close depending on other players
+        if (!(achievement->flags & (ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL)))
+            SetCriteriaKnownCompleted(criteria->ID, true);
+
         return false;
+    }
 
     return true;
 }
 
+void AchievementMgr::SetCriteriaKnownCompleted(uint32 criteriaId, bool completed)
+{
+    if (criteriaId >= _completedCriteria.size())
+    {
+        if (!completed)
+            return;
+
+        _completedCriteria.resize(std::max<std::size_t>(criteriaId + 1, sAchievementCriteriaStore.GetNumRows()));
+    }
+
+    _completedCriteria[criteriaId] = completed;
+}
+
 CompletedAchievementMap const& AchievementMgr::GetCompletedAchievements()
 {
     return _completedAchievements;
@@ -25,6 +25,8 @@
 #include "ObjectGuid.h"
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 typedef std::list<AchievementCriteriaEntry const*> AchievementCriteriaEntryList;
 typedef std::list<AchievementEntry const*>         AchievementEntryList;
@@ -325,6 +327,8 @@ private:
     bool IsCompletedCriteria(AchievementCriteriaEntry const* achievementCriteria, AchievementEntry const* achievement);
     bool IsCompletedAchievement(AchievementEntry const* entry);
     bool CanUpdateCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement);
+    [[nodiscard]] bool IsCriteriaKnownCompleted(uint32 criteriaId) const { return criteriaId < _completedCriteria.size() && _completedCriteria[criteriaId]; }
+    void SetCriteriaKnownCompleted(uint32 criteriaId, bool completed);
     void BuildAllDataPacket(WorldPacket* data) const;
 
     void UpdateTimedAchievements(uint32 timeDiff);
@@ -338,6 +342,8 @@ private:
     CompletedAchievementMap _completedAchievements;
     typedef std::map<uint32, uint32> TimedAchievementMap;
     TimedAchievementMap _timedAchievements;      // Criteria id/time left in MS
+    // Criteria id bitset of criteria that can no longer progress, lets updates skip them without any lookup
+    std::vector<bool> _completedCriteria;
 
     // Offline updates cannot be processed while players are loading,
     // as the player will not be notified of the changes.
@@ -363,18 +369,16 @@ public:
         return &_achievementCriteriasByType[type];
     }
 
-    AchievementCriteriaEntryList const* GetSpecialAchievementCriteriaByType(AchievementCriteriaTypes type, uint32 val)
+    [[nodiscard]] AchievementCriteriaEntryList const* GetSpecialAchievementCriteriaByType(AchievementCriteriaTypes type, uint32 val) const
     {
-        if (_specialList[type].find(val) != _specialList[type].end())
-            return &_specialList[type][val];
-        return nullptr;
+        auto itr = _specialList[type].find(val);
+        return itr != _specialList[type].end() ? &itr->second : nullptr;
     }
 
-    AchievementCriteriaEntryList const* GetAchievementCriteriaByCondition(AchievementCriteriaCondition condition, uint32 val)
+    [[nodiscard]] AchievementCriteriaEntryList const* GetAchievementCriteriaByCondition(AchievementCriteriaCondition condition, uint32 val) const
     {
-        if (_achievementCriteriasByCondition[condition].find(val) != _achievementCriteriasByCondition[condition].end())
-            return &_achievementCriteriasByCondition[condition][val];
-        return nullptr;
+        auto itr = _achievementCriteriasByCondition[condition].find(val);
+        return itr != _achievementCriteriasByCondition[condition].end() ? &itr->second : nullptr;
     }
 
     [[nodiscard]] AchievementCriteriaEntryList const& GetTimedAchievementCriteriaByType(AchievementCriteriaTimedTypes type) const
@@ -444,8 +448,9 @@ private:
     AchievementRewardLocales _achievementRewardLocales;
 
     // pussywizard:
-    std::map<uint32, AchievementCriteriaEntryList> _specialList[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
-    std::map<uint32, AchievementCriteriaEntryList> _achievementCriteriasByCondition[ACHIEVEMENT_CRITERIA_CONDITION_TOTAL];
+    // criteria by type and their primary misc value (creature entry, spell id, item id, ...)
+    std::unordered_map<uint32, AchievementCriteriaEntryList> _specialList[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+    std::unordered_map<uint32, AchievementCriteriaEntryList> _achievementCriteriasByCondition[ACHIEVEMENT_CRITERIA_CONDITION_TOTAL];
 };
 
 #define sAchievementMgr AchievementGlobalMgr::instance()
@@ -32,6 +32,7 @@
 #include "SpellAuras.h"
 #include "SpellMgr.h"
 #include "WorldState.h"
+#include <array>
 
 // Checks if object meets the condition
 // Can have CONDITION_SOURCE_TYPE_NONE && !mReferenceId if called from a special event (ie: eventAI)
@@ -868,13 +869,14 @@ ConditionMgr* ConditionMgr::instance()
     return &instance;
 }
 
-ConditionList ConditionMgr::GetConditionReferences(uint32 refId)
+static ConditionList const EmptyConditionList;
+
+ConditionList const& ConditionMgr::GetConditionReferences(uint32 refId) const
 {
-    ConditionList                               conditions;
     ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find(refId);
     if (ref != ConditionReferenceStore.end())
-        conditions = (*ref).second;
-    return conditions;
+        return ref->second;
+    return EmptyConditionList;
 }
 
 uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionList const& conditions)
@@ -897,9 +899,8 @@ uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionList const& co
 
         if ((*i)->ReferenceId) // handle reference
         {
-            ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find((*i)->ReferenceId);
-            ASSERT(ref != ConditionReferenceStore.end() && "ConditionMgr::GetSearcherTypeMaskForConditionList - incorrect reference");
-            ElseGroupStore[(*i)->ElseGroup] &= GetSearcherTypeMaskForConditionList((*ref).second);
+            ASSERT((*i)->ReferenceConditions && "ConditionMgr::GetSearcherTypeMaskForConditionList - incorrect reference");
+            ElseGroupStore[(*i)->ElseGroup] &= GetSearcherTypeMaskForConditionList(*(*i)->ReferenceConditions);
         }
         else // handle normal condition
         {
@@ -918,43 +919,68 @@ uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionList const& co
 
 bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions)
 {
-    //     groupId, groupCheckPassed
-    std::map<uint32, bool> ElseGroupStore;
-    for (ConditionList::const_iterator i = conditions.begin(); i != conditions.end(); ++i)
+    // Lists rarely use more than a couple of else groups, so their state lives on the stack
+    // instead of in a per call std::map. Lists with more groups than fit fall back to a heap copy.
+    struct ElseGroupState
+    {
+        uint32 ElseGroup;
+        bool Passed;
+    };
+
+    std::array<ElseGroupState, 8> localGroups;
+    std::vector<ElseGroupState> overflowGroups;
+    std::size_t groupCount = 0;
+
+    auto findGroup = [&](uint32 elseGroup) -> ElseGroupState*
     {
-        LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList condType: {} val1: {}", (*i)->ConditionType, (*i)->ConditionValue1);
-        if ((*i)->isLoaded())
+        ElseGroupState* groups = overflowGroups.empty() ? localGroups.data() : overflowGroups.data();
+        for (std::size_t g = 0; g < groupCount; ++g)
+            if (groups[g].ElseGroup == elseGroup)
+                return &groups[g];
+
+        if (groupCount == localGroups.size())
+            overflowGroups.assign(localGroups.begin(), localGroups.end());
+
+        if (!overflowGroups.empty())
         {
-            //! Find ElseGroup in ElseGroupStore
-            std::map<uint32, bool>::const_iterator itr = ElseGroupStore.find((*i)->ElseGroup);
-            //! If not found, add an entry in the store and set to true (placeholder)
-            if (itr == ElseGroupStore.end())
-                ElseGroupStore[(*i)->ElseGroup] = true;
-            else if (!(*itr).second)
-                continue;
+            overflowGroups.push_back({ elseGroup, true });
+            ++groupCount;
+            return &overflowGroups.back();
+        }
+
+        localGroups[groupCount] = { elseGroup, true };
+        return &localGroups[groupCount++];
+    };
+
+    for (Condition* condition : conditions)
+    {
+        LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList condType: {} val1: {}", condition->ConditionType, condition->ConditionValue1);
+        if (!condition->isLoaded())
+            continue;
+
+        ElseGroupState* group = findGroup(condition->ElseGroup);
+        if (!group->Passed)
+            continue;
 
-            if ((*i)->ReferenceId) // handle reference
+        if (condition->ReferenceId) // handle reference
+        {
+            if (condition->ReferenceConditions)
             {
-                ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find((*i)->ReferenceId);
-                if (ref != ConditionReferenceStore.end())
-                {
-                    if (!IsObjectMeetToConditionList(sourceInfo, (*ref).second))
-                        ElseGroupStore[(*i)->ElseGroup] = false;
-                }
-                else
-                {
-                    LOG_DEBUG("condition", "IsPlayerMeetToConditionList: Reference template -{} not found", (*i)->ReferenceId);
-                }
+                if (!IsObjectMeetToConditionList(sourceInfo, *condition->ReferenceConditions))
+                    group->Passed = false;
             }
-            else // handle normal condition
+            else
             {
-                if (!(*i)->Meets(sourceInfo))
-                    ElseGroupStore[(*i)->ElseGroup] = false;
+                LOG_DEBUG("condition", "IsPlayerMeetToConditionList: Reference template -{} not found", condition->ReferenceId);
             }
         }
+        else if (!condition->Meets(sourceInfo)) // handle normal condition
+            group->Passed = false;
     }
-    for (std::map<uint32, bool>::const_iterator i = ElseGroupStore.begin(); i != ElseGroupStore.end(); ++i)
-        if (i->second)
+
+    ElseGroupState const* groups = overflowGroups.empty() ? localGroups.data() : overflowGroups.data();
+    for (std::size_t g = 0; g < groupCount; ++g)
+        if (groups[g].Passed)
             return true;
 
     return false;
@@ -993,9 +1019,8 @@ bool ConditionMgr::CanHaveSourceIdSet(ConditionSourceType sourceType) const
     return (sourceType == CONDITION_SOURCE_TYPE_SMART_EVENT || sourceType == CONDITION_SOURCE_TYPE_OBJECT_VISIBILITY);
 }
 
-ConditionList ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry)
+ConditionList const& ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry) const
 {
-    ConditionList spellCond;
     if (sourceType > CONDITION_SOURCE_TYPE_NONE && sourceType < CONDITION_SOURCE_TYPE_MAX)
     {
         ConditionContainer::const_iterator itr = ConditionStore.find(sourceType);
@@ -1004,72 +1029,67 @@ ConditionList ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType
             ConditionTypeContainer::const_iterator i = (*itr).second.find(entry);
             if (i != (*itr).second.end())
             {
-                spellCond = (*i).second;
                 LOG_DEBUG("condition", "GetConditionsForNotGroupedEntry: found conditions for type {} and entry {}", uint32(sourceType), entry);
+                return (*i).second;
             }
         }
     }
-    return spellCond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId)
+ConditionList const& ConditionMgr::GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId) const
 {
-    ConditionList                                   cond;
     CreatureSpellConditionContainer::const_iterator itr = SpellClickEventConditionStore.find(creatureId);
     if (itr != SpellClickEventConditionStore.end())
     {
         ConditionTypeContainer::const_iterator i = (*itr).second.find(spellId);
         if (i != (*itr).second.end())
         {
-            cond = (*i).second;
             LOG_DEBUG("condition", "GetConditionsForSpellClickEvent: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
+            return (*i).second;
         }
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId)
+ConditionList const& ConditionMgr::GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId) const
 {
-    ConditionList                                   cond;
     CreatureSpellConditionContainer::const_iterator itr = VehicleSpellConditionStore.find(creatureId);
     if (itr != VehicleSpellConditionStore.end())
     {
         ConditionTypeContainer::const_iterator i = (*itr).second.find(spellId);
         if (i != (*itr).second.end())
         {
-            cond = (*i).second;
             LOG_DEBUG("condition", "GetConditionsForVehicleSpell: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
+            return (*i).second;
         }
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType)
+ConditionList const& ConditionMgr::GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType) const
 {
-    ConditionList                                cond;
     SmartEventConditionContainer::const_iterator itr = SmartEventConditionStore.find(std::make_pair(entryOrGuid, sourceType));
     if (itr != SmartEventConditionStore.end())
     {
         ConditionTypeContainer::const_iterator i = (*itr).second.find(eventId + 1);
         if (i != (*itr).second.end())
         {
-            cond = (*i).second;
             LOG_DEBUG("condition", "GetConditionsForSmartEvent: found conditions for Smart Event entry or guid {} event_id {}", entryOrGuid, eventId);
+            return (*i).second;
         }
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId)
+ConditionList const& ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId) const
 {
-    ConditionList                               cond;
     NpcVendorConditionContainer::const_iterator itr = NpcVendorConditionContainerStore.find(creatureId);
     if (itr != NpcVendorConditionContainerStore.end())
     {
         ConditionTypeContainer::const_iterator i = (*itr).second.find(itemId);
         if (i != (*itr).second.end())
         {
-            cond = (*i).second;
             if (itemId)
             {
                 LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {} item {}", creatureId, itemId);
@@ -1078,24 +1098,23 @@ ConditionList ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId, ui
             {
                 LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {}", creatureId);
             }
+            return (*i).second;
         }
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForObjectVisibility(WorldObject const* object) const
+ConditionList const& ConditionMgr::GetConditionsForObjectVisibility(WorldObject const* object) const
 {
-    ConditionList cond;
-
     if (!object->IsCreature() && !object->IsGameObject())
-        return cond;
+        return EmptyConditionList;
 
     uint32 entry = object->GetEntry();
     uint32 sourceGroup = object->IsGameObject() ? 1 : 0;
 
     auto itrBucket = ObjectVisibilityConditionStore.find(std::make_pair(entry, sourceGroup));
     if (itrBucket == ObjectVisibilityConditionStore.end())
-        return cond;
+        return EmptyConditionList;
 
     uint32 guid = object->IsGameObject() ? object->ToGameObject()->GetSpawnId() : object->ToCreature()->GetSpawnId();
 
@@ -1104,20 +1123,56 @@ ConditionList ConditionMgr::GetConditionsForObjectVisibility(WorldObject const*
     auto itrGuid = sourceIdConditions.find(guid);
     if (itrGuid != sourceIdConditions.end())
     {
-        cond.insert(cond.end(), itrGuid->second.begin(), itrGuid->second.end());
         LOG_DEBUG("condition", "GetConditionsForObjectVisibility: found guid-level conditions for sourceGroup {} entry {} guid {}", sourceGroup, entry, guid);
+        return itrGuid->second;
     }
-    else
+
+    auto itrEntry = sourceIdConditions.find(0);
+    if (itrEntry != sourceIdConditions.end())
     {
-        auto itrEntry = sourceIdConditions.find(0);
-        if (itrEntry != sourceIdConditions.end())
-        {
-            cond.insert(cond.end(), itrEntry->second.begin(), itrEntry->second.end());
-            LOG_DEBUG("condition", "GetConditionsForObjectVisibility: found entry-level conditions for sourceGroup {} entry {}", sourceGroup, entry);
-        }
+        LOG_DEBUG("condition", "GetConditionsForObjectVisibility: found entry-level conditions for sourceGroup {} entry {}", sourceGroup, entry);
+        return itrEntry->second;
     }
 
-    return cond;
+    return EmptyConditionList;
+}
+
+void ConditionMgr::ResolveConditionReferences(ConditionList const& conditions)
+{
+    for (Condition* condition : conditions)
+    {
+        if (!condition->ReferenceId)
+            continue;
+
+        ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find(condition->ReferenceId);
+        condition->ReferenceConditions = ref != ConditionReferenceStore.end() ? &ref->second : nullptr;
+    }
+}
+
+void ConditionMgr::ResolveConditionReferences()
+{
+    for (auto const& [refId, conditions] : ConditionReferenceStore)
+        ResolveConditionReferences(conditions);
+
+    for (auto const& [sourceType, typeContainer] : ConditionStore)
+        for (auto const& [entry, conditions] : typeContainer)
+            ResolveConditionReferences(conditions);
+
+    for (CreatureSpellConditionContainer const* store : { &VehicleSpellConditionStore, &SpellClickEventConditionStore, &NpcVendorConditionContainerStore })
+        for (auto const& [creatureId, typeContainer] : *store)
+            for (auto const& [entry, conditions] : typeContainer)
+                ResolveConditionReferences(conditions);
+
+    for (auto const& [key, typeContainer] : SmartEventConditionStore)
+        for (auto const& [eventId, conditions] : typeContainer)
+            ResolveConditionReferences(conditions);
+
+    for (auto const& [key, sourceIdContainer] : ObjectVisibilityConditionStore)
+        for (auto const& [sourceId, conditions] : sourceIdContainer)
+            ResolveConditionReferences(conditions);
+
+    // conditions attached to loot, gossip and spell implicit target lists
+    ResolveConditionReferences(AllocatedMemoryStore);
 }
 
 void ConditionMgr::LoadConditions(bool isReload)
@@ -1401,6 +1456,8 @@ void ConditionMgr::LoadConditions(bool isReload)
         ++count;
     } while (result->NextRow());
 
+    ResolveConditionReferences();
+
     LOG_INFO("server.loading", ">> Loaded {} conditions in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
@@ -2727,7 +2784,7 @@ void ConditionMgr::Clean()
     ObjectVisibilityConditionStore.clear();
 
     // this is a BIG hack, feel free to fix it if you can figure out the ConditionMgr ;)
-    for (std::list<Condition*>::const_iterator itr = AllocatedMemoryStore.begin(); itr != AllocatedMemoryStore.end(); ++itr) delete *itr;
+    for (ConditionList::const_iterator itr = AllocatedMemoryStore.begin(); itr != AllocatedMemoryStore.end(); ++itr) delete *itr;
 
     AllocatedMemoryStore.clear();
 }
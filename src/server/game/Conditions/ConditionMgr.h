@@ -21,6 +21,8 @@
 #include "Define.h"
 #include <list>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 class Player;
 class Unit;
@@ -211,6 +213,7 @@ struct Condition
     uint32                  ScriptId;
     uint8                   ConditionTarget;
     bool                    NegativeCondition;
+    std::vector<Condition*> const* ReferenceConditions; // reference template resolved from ReferenceId at load time
 
     Condition()
     {
@@ -229,6 +232,7 @@ struct Condition
         ErrorTextId        = 0;
         ScriptId           = 0;
         NegativeCondition  = false;
+        ReferenceConditions = nullptr;
     }
 
     bool Meets(ConditionSourceInfo& sourceInfo);
@@ -237,13 +241,13 @@ struct Condition
     uint32 GetMaxAvailableConditionTargets();
 };
 
-typedef std::list<Condition*> ConditionList;
-typedef std::map<uint32, ConditionList> ConditionTypeContainer;
+typedef std::vector<Condition*> ConditionList;
+typedef std::unordered_map<uint32, ConditionList> ConditionTypeContainer;
 typedef std::map<ConditionSourceType, ConditionTypeContainer> ConditionContainer;
 typedef std::map<uint32, ConditionTypeContainer> CreatureSpellConditionContainer;
 typedef std::map<uint32, ConditionTypeContainer> NpcVendorConditionContainer;
 typedef std::map<std::pair<int32, uint32 /*SAI source_type*/>, ConditionTypeContainer> SmartEventConditionContainer;
-typedef std::map<std::pair<uint32 /*SourceEntry*/, uint32 /*SourceGroup*/>, std::map<uint32 /*SourceId*/, ConditionList>> ObjectVisibilityConditionContainer;
+typedef std::map<std::pair<uint32 /*SourceEntry*/, uint32 /*SourceGroup*/>, std::unordered_map<uint32 /*SourceId*/, ConditionList>> ObjectVisibilityConditionContainer;
 
 typedef std::map<uint32, ConditionList> ConditionReferenceContainer;//only used for references
 
@@ -258,7 +262,7 @@ public:
 
     void LoadConditions(bool isReload = false);
     bool isConditionTypeValid(Condition* cond);
-    ConditionList GetConditionReferences(uint32 refId);
+    ConditionList const& GetConditionReferences(uint32 refId) const;
 
     uint32 GetSearcherTypeMaskForConditionList(ConditionList const& conditions);
     bool IsObjectMeetToConditions(WorldObject* object, ConditionList const& conditions);
@@ -266,12 +270,12 @@ public:
     bool IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, ConditionList const& conditions);
     [[nodiscard]] bool CanHaveSourceGroupSet(ConditionSourceType sourceType) const;
     [[nodiscard]] bool CanHaveSourceIdSet(ConditionSourceType sourceType) const;
-    ConditionList GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry);
-    ConditionList GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId);
-    ConditionList GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType);
-    ConditionList GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId);
-    ConditionList GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId);
-    ConditionList GetConditionsForObjectVisibility(WorldObject const* object) const;
+    ConditionList const& GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry) const;
+    ConditionList const& GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId) const;
+    ConditionList const& GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType) const;
+    ConditionList const& GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId) const;
+    ConditionList const& GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId) const;
+    ConditionList const& GetConditionsForObjectVisibility(WorldObject const* object) const;
 
 private:
     bool isSourceTypeValid(Condition* cond);
@@ -280,9 +284,11 @@ private:
     bool addToGossipMenuItems(Condition* cond);
     bool addToSpellImplicitTargetConditions(Condition* cond);
     bool IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions);
+    void ResolveConditionReferences(ConditionList const& conditions);
+    void ResolveConditionReferences();
 
     void Clean(); // free up resources
-    std::list<Condition*> AllocatedMemoryStore; // some garbage collection :)
+    ConditionList AllocatedMemoryStore; // some garbage collection :)
 
     ConditionContainer                 ConditionStore;
     ConditionReferenceContainer        ConditionReferenceStore;
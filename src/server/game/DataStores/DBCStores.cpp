@@ -17,6 +17,7 @@
 
 #include "DBCStores.h"
 #include "BattlegroundMgr.h"
+#include "Config.h"
 #include "DBCFileLoader.h"
 #include "DBCfmt.h"
 #include "Errors.h"
@@ -26,7 +27,11 @@
 #include "SpellMgr.h"
 #include "TransportMgr.h"
 #include "World.h"
+#include <atomic>
+#include <functional>
 #include <map>
+#include <mutex>
+#include <thread>
 
 typedef std::map<uint16, uint32> AreaFlagByAreaID;
 typedef std::map<uint32, uint32> AreaFlagByMapID;
@@ -209,30 +214,39 @@ static bool LoadDBC_assert_print(uint32 fsize, uint32 rsize, std::string const&
     return false;
 }
 
+struct DBCLoadContext
+{
+    explicit DBCLoadContext(std::string const& dbcPath) : DbcPath(dbcPath), AvailableDbcLocales(0xFFFFFFFF) { }
+
+    std::string DbcPath;
+    std::atomic<uint32> AvailableDbcLocales;
+    std::mutex ErrorsLock;
+    StoreProblemList Errors;
+};
+
 template<class T>
-inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCStorage<T>& storage, std::string const& dbcPath, std::string const& filename, char const* dbTable = nullptr)
+inline void LoadDBC(DBCLoadContext& context, DBCStorage<T>& storage, std::string const& filename, char const* dbTable = nullptr)
 {
     // compatibility format and C++ structure sizes
     ASSERT(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDBC_assert_print(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
 
-    ++DBCFileCount;
-    std::string dbcFilename = dbcPath + filename;
+    std::string dbcFilename = context.DbcPath + filename;
     bool existDBData = false;
 
     if (storage.Load(dbcFilename.c_str()))
     {
         for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
         {
-            if (!(availableDbcLocales & (1 << i)))
+            if (!(context.AvailableDbcLocales & (1 << i)))
                 continue;
 
-            std::string localizedName(dbcPath);
+            std::string localizedName(context.DbcPath);
             localizedName.append(localeNames[i]);
             localizedName.push_back('/');
             localizedName.append(filename);
 
             if (!storage.LoadStringsFrom(localizedName.c_str()))
-                availableDbcLocales &= ~(1 << i);             // mark as not available for speedup next checks
+                context.AvailableDbcLocales &= ~(1 << i);     // mark as not available for speedup next checks
         }
     }
 
@@ -244,30 +258,63 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
 
     if (!existDBData)
     {
+        std::string problem;
+
         // sort problematic dbc to (1) non compatible and (2) non-existed
         if (FILE* f = fopen(dbcFilename.c_str(), "rb"))
         {
             std::ostringstream stream;
             stream << dbcFilename << " exists, and has " << storage.GetFieldCount() << " field(s) (expected " << strlen(storage.GetFormat()) << "). Extracted file might be from wrong client version or a database-update has been forgotten.";
-            std::string buf = stream.str();
-            errors.push_back(buf);
+            problem = stream.str();
             fclose(f);
         }
         else
-            errors.push_back(dbcFilename);
+            problem = dbcFilename;
+
+        std::lock_guard<std::mutex> guard(context.ErrorsLock);
+        context.Errors.push_back(std::move(problem));
+    }
+}
+
+// Every store is independent until the post processing below, so the files (and their
+// world database overrides) are loaded by a few threads pulling from a shared task list
+static void RunDBCLoadTasks(std::vector<std::function<void()>> const& tasks, uint32 threadCount)
+{
+    threadCount = std::min<uint32>(threadCount, tasks.size());
+    if (threadCount <= 1)
+    {
+        for (std::function<void()> const& task : tasks)
+            task();
+
+        return;
     }
+
+    std::atomic<std::size_t> nextTask(0);
+    auto worker = [&tasks, &nextTask]()
+    {
+        for (std::size_t i = nextTask++; i < tasks.size(); i = nextTask++)
+            tasks[i]();
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (uint32 i = 1; i < threadCount; ++i)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread& thread : threads)
+        thread.join();
 }
 
 void LoadDBCStores(std::string const& dataPath)
 {
     uint32 oldMSTime = getMSTime();
 
-    std::string dbcPath = dataPath + "dbc/";
-
-    StoreProblemList bad_dbc_files;
-    uint32 availableDbcLocales = 0xFFFFFFFF;
+    DBCLoadContext context(dataPath + "dbc/");
+    std::vector<std::function<void()>> loadTasks;
 
-#define LOAD_DBC(store, file, dbtable) LoadDBC(availableDbcLocales, bad_dbc_files, store, dbcPath, file, dbtable)
+#define LOAD_DBC(store, file, dbtable) loadTasks.emplace_back([&context]() { LoadDBC(context, store, file, dbtable); })
 
     LOAD_DBC(sAreaTableStore,                       "AreaTable.dbc",                        "areatable_dbc");
     LOAD_DBC(sAchievementStore,                     "Achievement.dbc",                      "achievement_dbc");
@@ -384,6 +431,12 @@ void LoadDBCStores(std::string const& dataPath)
 
 #undef LOAD_DBC
 
+    DBCFileCount = loadTasks.size();
+    RunDBCLoadTasks(loadTasks, sConfigMgr->GetOption<uint32>("DBC.LoadThreads", 4));
+
+    StoreProblemList& bad_dbc_files = context.Errors;
+    bad_dbc_files.sort();
+
     for (CharStartOutfitEntry const* outfit : sCharStartOutfitStore)
         sCharStartOutfitMap[outfit->Race | (outfit->Class << 8) | (outfit->Gender << 16)] = outfit;
 
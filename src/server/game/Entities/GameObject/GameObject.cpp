@@ -1045,6 +1045,7 @@ void GameObject::SaveToDB(uint32 mapid, uint8 spawnMask, uint32 phaseMask, bool
     // update in loaded data (changing data only in this place)
     GameObjectData& data = sObjectMgr->NewGOData(m_spawnId);
 
+    data.spawnId = m_spawnId;
     data.id = GetEntry();
     data.mapid = mapid;
     data.phaseMask = phaseMask;
@@ -1059,6 +1060,8 @@ void GameObject::SaveToDB(uint32 mapid, uint8 spawnMask, uint32 phaseMask, bool
     data.spawnMask = spawnMask;
     data.artKit = GetGoArtKit();
 
+    sObjectMgr->UpdateSpawnSpatialIndex(&data);
+
     // Update in DB
     WorldDatabaseTransaction trans = WorldDatabase.BeginTransaction();
 
@@ -2640,6 +2643,9 @@ void GameObject::EnableCollision(bool enable)
         phaseMask = GetPhaseMask();
 
     m_model->enable(phaseMask);
+
+    if (Map* map = FindMap())
+        map->OnGameObjectCollisionChanged();
 }
 
 void GameObject::UpdateModel()
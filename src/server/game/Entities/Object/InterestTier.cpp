@@ -0,0 +1,62 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "InterestTier.h"
+#include "Map.h"
+#include "Player.h"
+#include "World.h"
+
+InterestTierClassifier::InterestTierClassifier(WorldObject const* object)
+{
+    float const nearDistance = sWorld->getFloatConfig(CONFIG_INTEREST_NEAR_DISTANCE);
+    if (nearDistance <= 0.0f)
+        return;
+
+    // Only units change often enough to be worth it, and BG/arena frames need live updates of far enemies
+    Unit const* unit = object->ToUnit();
+    if (!unit || unit->GetMap()->IsBattlegroundOrArena())
+        return;
+
+    _unit = unit;
+    _nearDistanceSq = nearDistance * nearDistance;
+    _target = unit->GetTarget();
+    _charmerOrOwner = unit->GetCharmerOrOwnerGUID();
+    _player = unit->GetCharmerOrOwnerPlayerOrPlayerItself();
+    _group = _player ? _player->GetGroup() : nullptr;
+    _inCombat = unit->IsInCombat();
+}
+
+InterestTier InterestTierClassifier::GetTier(Player const* observer) const
+{
+    if (!_unit || observer == _unit)
+        return InterestTier::Near;
+
+    if (observer->GetSightPosition().GetExactDist2dSq(_unit) <= _nearDistanceSq)
+        return InterestTier::Near;
+
+    if (observer->GetTarget() == _unit->GetGUID() || _target == observer->GetGUID() || _charmerOrOwner == observer->GetGUID())
+        return InterestTier::Near;
+
+    if (observer == _player || (_group && observer->GetGroup() == _group))
+        return InterestTier::Near;
+
+    // Combat flags first, the combat reference lookup is the only non trivial check
+    if (_inCombat && observer->IsInCombat() && _unit->IsInCombatWith(observer))
+        return InterestTier::Near;
+
+    return InterestTier::Far;
+}
@@ -0,0 +1,68 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _INTERESTTIER_H
+#define _INTERESTTIER_H
+
+#include "Define.h"
+#include "ObjectGuid.h"
+
+class Group;
+class Player;
+class Unit;
+class WorldObject;
+
+/**
+ * How closely an observer follows an object it has at client.
+ *
+ * Far observers of a unit get its value updates coalesced and flushed every
+ * Visibility.Interest.FarUpdateInterval and only a share of its movement heartbeats.
+ * Units the observer targets, groups with, owns or fights always stay near.
+ */
+enum class InterestTier : uint8
+{
+    Near,
+    Far
+};
+
+/**
+ * Classifies the observers of one object.
+ *
+ * The config and the state of the object are read once at construction,
+ * so classifying each observer only costs a few comparisons.
+ */
+class InterestTierClassifier
+{
+public:
+    explicit InterestTierClassifier(WorldObject const* object);
+
+    /// False when every observer is near: tiers disabled, not a unit or a battleground/arena map
+    [[nodiscard]] bool CanBeFar() const { return _unit != nullptr; }
+
+    [[nodiscard]] InterestTier GetTier(Player const* observer) const;
+
+private:
+    Unit const* _unit{nullptr};
+    float _nearDistanceSq{0.0f};
+    ObjectGuid _target;
+    ObjectGuid _charmerOrOwner;
+    Player const* _player{nullptr};
+    Group const* _group{nullptr};
+    bool _inCombat{false};
+};
+
+#endif
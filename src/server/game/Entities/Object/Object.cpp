@@ -25,6 +25,7 @@
 #include "GameObjectAI.h"
 #include "GameTime.h"
 #include "GridNotifiers.h"
+#include "InterestTier.h"
 #include "Log.h"
 #include "MapMgr.h"
 #include "MiscPackets.h"
@@ -1061,7 +1062,7 @@ WorldObject::WorldObject() : WorldLocation(),
     LastUsedScriptID(0), m_name(""), m_isActive(false), _visibilityDistanceOverrideType(VisibilityDistanceType::Normal), m_zoneScript(nullptr),
     _zoneId(0), _areaId(0), _floorZ(INVALID_HEIGHT), _outdoors(false), _liquidData(), _updatePositionData(false), m_transport(nullptr),
     m_currMap(nullptr), _heartbeatTimer(HEARTBEAT_INTERVAL), m_InstanceId(0), m_phaseMask(PHASEMASK_NORMAL), m_useCombinedPhases(true),
-    m_notifyflags(0), m_executed_notifies(0), _objectVisibilityContainer(this)
+    m_notifyflags(0), m_executed_notifies(0), _objectVisibilityContainer(this), _movementHeartbeatCount(0)
 {
     m_serverSideVisibility.SetValue(SERVERSIDE_VISIBILITY_GHOST, GHOST_VISIBILITY_ALIVE | GHOST_VISIBILITY_GHOST);
     m_serverSideVisibilityDetect.SetValue(SERVERSIDE_VISIBILITY_GHOST, GHOST_VISIBILITY_ALIVE);
@@ -1236,6 +1237,8 @@ void WorldObject::RemoveFromWorld()
 
     GetObjectVisibilityContainer().CleanVisibilityReferences();
 
+    ClearDeferredUpdate();
+
     Object::RemoveFromWorld();
 }
 
@@ -2181,6 +2184,24 @@ void WorldObject::SendMessageToSet(WorldPacket const* data, Player const* skippe
     notifier.Visit(GetObjectVisibilityContainer().GetVisiblePlayersMap());
 }
 
+void WorldObject::SendMovementHeartbeatToSet(WorldPacket const* data, Player const* skipped_rcvr)
+{
+    uint32 const farRate = sWorld->getIntConfig(CONFIG_INTEREST_FAR_HEARTBEAT_RATE);
+    if (farRate <= 1 || ++_movementHeartbeatCount % farRate == 0)
+    {
+        SendMessageToSet(data, skipped_rcvr);
+        return;
+    }
+
+    if (Player* player = ToPlayer(); player && player != skipped_rcvr)
+        player->SendDirectMessage(data);
+
+    InterestTierClassifier const interest(this);
+    for (auto const& [guid, player] : GetObjectVisibilityContainer().GetVisiblePlayersMap())
+        if (player != skipped_rcvr && interest.GetTier(player) == InterestTier::Near)
+            player->SendDirectMessage(data);
+}
+
 void WorldObject::SendObjectDeSpawnAnim(ObjectGuid guid)
 {
     WorldPacket data(SMSG_GAMEOBJECT_DESPAWN_ANIM, 8);
@@ -3078,7 +3099,7 @@ void WorldObject::AddToNotify(uint16 f)
         {
             if (f & NOTIFY_VISIBILITY_CHANGED)
             {
-                uint32 EVENT_VISIBILITY_DELAY = u->FindMap() ? DynamicVisibilityMgr::GetVisibilityNotifyDelay(u->FindMap()->GetEntry()->map_type) : 1000;
+                uint32 EVENT_VISIBILITY_DELAY = u->FindMap() ? DynamicVisibilityMgr::GetVisibilityNotifyDelay(u->FindMap()) : 1000;
 
                 uint32 diff = getMSTimeDiff(u->m_last_notify_mstime, GameTime::GetGameTimeMS().count());
                 if (diff >= EVENT_VISIBILITY_DELAY / 2)
@@ -3090,7 +3111,7 @@ void WorldObject::AddToNotify(uint16 f)
             }
             else if (f & NOTIFY_AI_RELOCATION)
             {
-                u->m_delayed_unit_ai_notify_timer = u->FindMap() ? DynamicVisibilityMgr::GetAINotifyDelay(u->FindMap()->GetEntry()->map_type) : 500;
+                u->m_delayed_unit_ai_notify_timer = u->FindMap() ? DynamicVisibilityMgr::GetAINotifyDelay(u->FindMap()) : 500;
             }
 
             m_notifyflags |= f;
@@ -3103,15 +3124,72 @@ void WorldObject::BuildUpdate(UpdateDataMapType& data_map)
     if (IsPlayer())
         BuildFieldsUpdate(ToPlayer(), data_map);
 
-    // Build update for visible players
-    DoForAllVisiblePlayers([this, &data_map](Player* player)
+    InterestTierClassifier const interest(this);
+    if (!interest.CanBeFar() || !sWorld->getIntConfig(CONFIG_INTEREST_FAR_UPDATE_INTERVAL))
     {
-        BuildFieldsUpdate(player, data_map);
+        // Build update for visible players
+        DoForAllVisiblePlayers([this, &data_map](Player* player)
+        {
+            BuildFieldsUpdate(player, data_map);
+        });
+
+        ClearUpdateMask(false);
+        return;
+    }
+
+    // Build update for near players, far ones are only recorded, duplicates are dropped at flush
+    DoForAllVisiblePlayers([this, &data_map, &interest](Player* player)
+    {
+        if (interest.GetTier(player) == InterestTier::Far)
+            _deferredObservers.push_back(player->GetGUID());
+        else
+            BuildFieldsUpdate(player, data_map);
     });
 
+    if (!_deferredObservers.empty())
+    {
+        if (_deferredChangesMask.GetCount() != _changesMask.GetCount())
+            _deferredChangesMask.SetCount(_changesMask.GetCount());
+
+        _deferredChangesMask |= _changesMask;
+        GetMap()->AddDeferredUpdateObject(this);
+    }
+
     ClearUpdateMask(false);
 }
 
+void WorldObject::BuildDeferredUpdate(UpdateDataMapType& data_map)
+{
+    // Regular updates of this tick are already built, so the changes mask is empty
+    // and can hold the coalesced changes while building
+    _changesMask.Swap(_deferredChangesMask);
+
+    std::sort(_deferredObservers.begin(), _deferredObservers.end());
+    _deferredObservers.erase(std::unique(_deferredObservers.begin(), _deferredObservers.end()), _deferredObservers.end());
+
+    VisiblePlayersMap const& visiblePlayers = GetObjectVisibilityContainer().GetVisiblePlayersMap();
+    for (ObjectGuid const& guid : _deferredObservers)
+    {
+        auto itr = visiblePlayers.find(guid);
+        if (itr != visiblePlayers.end())
+            BuildFieldsUpdate(itr->second, data_map);
+    }
+
+    _changesMask.Swap(_deferredChangesMask);
+    _deferredChangesMask.Clear();
+    _deferredObservers.clear();
+}
+
+void WorldObject::ClearDeferredUpdate()
+{
+    if (_deferredObservers.empty())
+        return;
+
+    GetMap()->RemoveDeferredUpdateObject(this);
+    _deferredChangesMask.Clear();
+    _deferredObservers.clear();
+}
+
 void WorldObject::GetCreaturesWithEntryInRange(std::list<Creature*>& creatureList, float radius, uint32 entry)
 {
     Acore::AllCreaturesOfEntryInRange check(this, entry, radius);
@@ -566,6 +566,8 @@ public:
     virtual void SendMessageToSet(WorldPacket const* data, bool self) const;
     virtual void SendMessageToSetInRange(WorldPacket const* data, float dist, bool self) const;
     virtual void SendMessageToSet(WorldPacket const* data, Player const* skipped_rcvr) const;
+    // Like SendMessageToSet, but far observers only get one of every Visibility.Interest.FarHeartbeatRate packets
+    void SendMovementHeartbeatToSet(WorldPacket const* data, Player const* skipped_rcvr);
 
     virtual uint8 getLevelForTarget(WorldObject const* /*target*/) const { return 1; }
 
@@ -657,6 +659,7 @@ public:
     virtual void UpdateObjectVisibility(bool forced = true, bool fromUpdate = false);
     virtual void UpdateObjectVisibilityOnCreate() { UpdateObjectVisibility(true); }
     void BuildUpdate(UpdateDataMapType& data_map) override;
+    void BuildDeferredUpdate(UpdateDataMapType& data_map);
     void GetCreaturesWithEntryInRange(std::list<Creature*>& creatureList, float radius, uint32 entry);
 
     void SetPositionDataUpdate();
@@ -797,6 +800,13 @@ private:
     GuidUnorderedSet _allowedLooters;
 
     ObjectVisibilityContainer _objectVisibilityContainer;
+
+    // Value changes not yet sent to far observers, flushed by Map::SendObjectUpdates()
+    UpdateMask _deferredChangesMask;
+    GuidVector _deferredObservers;                         // appended every tick, deduplicated at flush
+    uint32 _movementHeartbeatCount;
+
+    void ClearDeferredUpdate();
 };
 
 namespace Acore
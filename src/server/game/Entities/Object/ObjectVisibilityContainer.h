@@ -20,15 +20,37 @@
 
 #include "Common.h"
 #include "ObjectGuid.h"
+#include <boost/container/flat_map.hpp>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 class Player;
 class WorldObject;
 
-typedef std::unordered_map<ObjectGuid, WorldObject*> VisibleWorldObjectsMap;
+// Kept sorted by guid so a visibility pass can be diffed against it with a linear merge
+typedef boost::container::flat_map<ObjectGuid, WorldObject*> VisibleWorldObjectsMap;
 typedef std::unordered_map<ObjectGuid, Player*> VisiblePlayersMap;
 
+enum class VisibilityChange : uint8
+{
+    None,
+    Enter,          // visited by the pass and visible, not yet at client
+    Leave,          // visited by the pass and at client, but no longer visible
+    LeaveFar        // at client, not visited by the pass and out of sight range
+};
+
+// Object examined during a visibility pass of a player, see Acore::VisibleNotifier
+struct VisibilityCandidate
+{
+    ObjectGuid Guid;
+    WorldObject* Object;
+    bool Visible;
+    VisibilityChange Change;
+};
+
+typedef std::vector<VisibilityCandidate> VisibilityCandidateList;
+
 // Class that manages the visibility containers of a worldobject
 class ObjectVisibilityContainer
 {
@@ -20,6 +20,7 @@
 
 #include "ByteBuffer.h"
 #include "Errors.h"
+#include <utility>
 
 class UpdateMask
 {
@@ -107,6 +108,13 @@ public:
         return *this;
     }
 
+    void Swap(UpdateMask& right)
+    {
+        std::swap(_fieldCount, right._fieldCount);
+        std::swap(_blockCount, right._blockCount);
+        std::swap(_bits, right._bits);
+    }
+
     UpdateMask operator|(UpdateMask const& right)
     {
         UpdateMask ret(*this);
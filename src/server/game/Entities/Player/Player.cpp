@@ -193,6 +193,13 @@ Player::Player(WorldSession* session): Unit(), m_mover(this), _cinematicMgr(*thi
 
     m_nextSave = sWorld->getIntConfig(CONFIG_INTERVAL_SAVE);
 
+    // nothing known about the stored rows until the first save
+    m_entryPointSaved = false;
+    m_hasSavedAuras = true;
+    m_hasSavedSpellCooldowns = true;
+    m_instanceResetTimesChanged = false;
+    m_saveStatementsAvoided = 0;
+
     m_areaUpdateId = 0;
     m_team = TEAM_NEUTRAL;
 
@@ -3784,10 +3791,6 @@ void Player::_LoadSpellCooldowns(PreparedQueryResult result)
 
 void Player::_SaveSpellCooldowns(CharacterDatabaseTransaction trans, bool logout)
 {
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN);
-    stmt->SetData(0, GetGUID().GetRawValue());
-    trans->Append(stmt);
-
     time_t curTime = GameTime::GetGameTime().count();
     uint32 curMSTime = GameTime::GetGameTimeMS().count();
     uint32 infTime = curMSTime + infinityCooldownDelayCheck;
@@ -3825,9 +3828,22 @@ void Player::_SaveSpellCooldowns(CharacterDatabaseTransaction trans, bool logout
         else
             ++itr;
     }
+    // nothing stored and nothing to store, skip the delete
+    if (first_round && !m_hasSavedSpellCooldowns)
+    {
+        ++m_saveStatementsAvoided;
+        return;
+    }
+
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN);
+    stmt->SetData(0, GetGUID().GetRawValue());
+    trans->Append(stmt);
+
     // if something changed execute
     if (!first_round)
         trans->Append(ss.str().c_str());
+
+    m_hasSavedSpellCooldowns = !first_round;
 }
 
 uint32 Player::resetTalentsCost() const
@@ -4413,18 +4429,6 @@ void Player::DeleteFromDB(ObjectGuid::LowType lowGuid, uint32 accountId, bool up
     }
 }
 
-/**
- * Characters which were kept back in the database after being deleted and are now too old (see config option "CharDelete.KeepDays"), will be completely deleted.
- */
-void Player::DeleteOldCharacters()
-{
-    uint32 keepDays = sWorld->getIntConfig(CONFIG_CHARDELETE_KEEP_DAYS);
-    if (!keepDays)
-        return;
-
-    Player::DeleteOldCharacters(keepDays);
-}
-
 /**
  * Characters which were kept back in the database after being deleted and are older than the specified amount of days, will be completely deleted.
  */
@@ -4448,49 +4452,6 @@ void Player::DeleteOldCharacters(uint32 keepDays)
     }
 }
 
-/**
- * Items which were kept back in the database after being deleted and are now too old (see config option "ItemDelete.KeepDays"), will be completely deleted.
- */
-void Player::DeleteOldRecoveryItems()
-{
-    uint32 keepDays = sWorld->getIntConfig(CONFIG_ITEMDELETE_KEEP_DAYS);
-    if (!keepDays)
-        return;
-
-    Player::DeleteOldRecoveryItems(keepDays);
-}
-
-/**
- * Items which were kept back in the database after being deleted and are older than the specified amount of days, will be completely deleted.
- */
-void Player::DeleteOldRecoveryItems(uint32 keepDays)
-{
-    LOG_INFO("server.loading", "Player::DeleteOldRecoveryItems: Deleting all items which have been deleted {} days before...", keepDays);
-    LOG_INFO("server.loading", " ");
-
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_RECOVERY_ITEM_OLD_ITEMS);
-    stmt->SetData(0, uint32(GameTime::GetGameTime().count() - time_t(keepDays * DAY)));
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-    if (result)
-    {
-        LOG_INFO("server.loading", "Player::DeleteOldRecoveryItems: Found {} item(s) to delete", result->GetRowCount());
-        do
-        {
-            Field* fields = result->Fetch();
-
-            uint32 guid = fields[0].Get<uint32>();
-            uint32 itemEntry = fields[1].Get<uint32>();
-
-            CharacterDatabasePreparedStatement* deleteStmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_RECOVERY_ITEM_BY_GUID);
-            deleteStmt->SetData(0, guid);
-            CharacterDatabase.Execute(deleteStmt);
-
-            LOG_INFO("server.loading", "Deleted item from recovery_item table where guid {} and item id {}", guid, itemEntry);
-        } while (result->NextRow());
-    }
-}
-
 /* Preconditions:
   - a resurrectable corpse must not be loaded for the player (only bones)
   - the player must be in world
@@ -9861,7 +9822,7 @@ void Player::VehicleSpellInitialize()
             continue;
         }
 
-        ConditionList conditions = sConditionMgr->GetConditionsForVehicleSpell(vehicle->GetEntry(), spellId);
+        ConditionList const& conditions = sConditionMgr->GetConditionsForVehicleSpell(vehicle->GetEntry(), spellId);
         if (!sConditionMgr->IsObjectMeetToConditions(this, vehicle, conditions))
         {
             LOG_DEBUG("condition", "VehicleSpellInitialize: conditions not met for Vehicle entry {} spell {}", vehicle->ToCreature()->GetEntry(), spellId);
@@ -10925,7 +10886,7 @@ bool Player::BuyItemFromVendorSlot(ObjectGuid vendorguid, uint32 vendorslot, uin
         return false;
     }
 
-    ConditionList conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), item);
+    ConditionList const& conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), item);
     if (!sConditionMgr->IsObjectMeetToConditions(this, creature, conditions))
     {
         //LOG_DEBUG("condition", "BuyItemFromVendor: conditions not met for creature entry {} item {}", creature->GetEntry(), item);
@@ -14609,7 +14570,7 @@ bool Player::CanSeeSpellClickOn(Creature const* c) const
         if (!itr->second.IsFitToRequirements(this, c))
             return false;
 
-        ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(c->GetEntry(), itr->second.spellId);
+        ConditionList const& conds = sConditionMgr->GetConditionsForSpellClickEvent(c->GetEntry(), itr->second.spellId);
         ConditionSourceInfo info = ConditionSourceInfo(const_cast<Player*>(this), const_cast<Creature*>(c));
         if (sConditionMgr->IsObjectMeetToConditions(info, conds))
             return true;
@@ -14623,7 +14584,7 @@ bool Player::CanSeeObjectByVisibilityConditions(WorldObject const* object) const
     if (IsGameMaster())
         return true;
 
-    ConditionList conds = sConditionMgr->GetConditionsForObjectVisibility(object);
+    ConditionList const& conds = sConditionMgr->GetConditionsForObjectVisibility(object);
     ConditionSourceInfo info = ConditionSourceInfo(const_cast<Player*>(this), const_cast<WorldObject*>(object));
     return sConditionMgr->IsObjectMeetToConditions(info, conds);
 }
@@ -14700,7 +14661,7 @@ bool Player::CanSeeVendor(Creature const* creature) const
     if (!creature->HasNpcFlag(UNIT_NPC_FLAG_VENDOR))
         return true;
 
-    ConditionList conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), 0);
+    ConditionList const& conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), 0);
     if (!sConditionMgr->IsObjectMeetToConditions(const_cast<Player*>(this), const_cast<Creature*>(creature), conditions))
         return false;
 
@@ -15012,6 +14973,15 @@ void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
     if (!mEntry)
         return;
 
+    if (m_entryPointSaved && m_entryPointData.IsSameAs(m_savedEntryPointData))
+    {
+        m_saveStatementsAvoided += 2;
+        return;
+    }
+
+    m_savedEntryPointData = m_entryPointData;
+    m_entryPointSaved = true;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_ENTRY_POINT);
     stmt->SetData(0, GetGUID().GetRawValue());
     trans->Append(stmt);
@@ -16327,6 +16297,14 @@ void Player::_SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans)
     if (_instanceResetTimes.empty())
         return;
 
+    if (!m_instanceResetTimesChanged)
+    {
+        m_saveStatementsAvoided += 1 + _instanceResetTimes.size();
+        return;
+    }
+
+    m_instanceResetTimesChanged = false;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES);
     stmt->SetData(0, GetSession()->GetAccountId());
     trans->Append(stmt);
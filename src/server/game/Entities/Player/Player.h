@@ -1056,6 +1056,13 @@ struct EntryPointData
 
     void ClearTaxiPath() { taxiPath.fill(0); }
     [[nodiscard]] bool HasTaxiPath() const { return taxiPath[0] && taxiPath[1]; }
+
+    [[nodiscard]] bool IsSameAs(EntryPointData const& right) const
+    {
+        return mountSpell == right.mountSpell && taxiPath == right.taxiPath && joinPos.GetMapId() == right.joinPos.GetMapId() &&
+            joinPos.GetPositionX() == right.joinPos.GetPositionX() && joinPos.GetPositionY() == right.joinPos.GetPositionY() &&
+            joinPos.GetPositionZ() == right.joinPos.GetPositionZ() && joinPos.GetOrientation() == right.joinPos.GetOrientation();
+    }
 };
 
 struct TradeStatusInfo
@@ -1611,12 +1618,8 @@ public:
     static void SavePositionInDB(WorldLocation const& loc, uint16 zoneId, ObjectGuid guid, CharacterDatabaseTransaction trans);
 
     static void DeleteFromDB(ObjectGuid::LowType lowGuid, uint32 accountId, bool updateRealmChars, bool deleteFinally);
-    static void DeleteOldCharacters();
     static void DeleteOldCharacters(uint32 keepDays);
 
-    static void DeleteOldRecoveryItems();
-    static void DeleteOldRecoveryItems(uint32 keepDays);
-
     bool m_mailsUpdated;
 
     void SetBindPoint(ObjectGuid guid);
@@ -2429,6 +2432,8 @@ public:
 
     // currently visible objects at player client
     std::vector<Unit*> m_newVisible; // pussywizard
+    // objects examined by the last visibility pass, kept to reuse its capacity
+    VisibilityCandidateList m_visibilityCandidates;
 
     [[nodiscard]] bool HaveAtClient(WorldObject const* u) const;
     [[nodiscard]] bool HaveAtClient(ObjectGuid guid) const;
@@ -2443,8 +2448,9 @@ public:
     void UpdateVisibilityOf(WorldObject* target);
     void UpdateTriggerVisibility();
 
-    template<class T>
-    void UpdateVisibilityOf(T* target, UpdateData& data, std::vector<Unit*>& visibleNow);
+    // Apply one change of the visibility diff built by Acore::VisibleNotifier
+    void CreateVisibleObject(WorldObject* target, UpdateData& data, std::vector<Unit*>& visibleNow);
+    void DestroyVisibleObject(WorldObject* target, UpdateData& data);
 
     uint8 m_forced_speed_changes[MAX_MOVE_TYPE];
 
@@ -2499,7 +2505,10 @@ public:
     void AddInstanceEnterTime(uint32 instanceId, time_t enterTime)
     {
         if (_instanceResetTimes.find(instanceId) == _instanceResetTimes.end())
+        {
             _instanceResetTimes.insert(InstanceTimeMap::value_type(instanceId, enterTime + HOUR));
+            m_instanceResetTimesChanged = true;
+        }
     }
 
     // last used pet number (for BG's)
@@ -2839,6 +2848,15 @@ protected:
     uint32 m_nextSave; // pussywizard
     uint16 m_additionalSaveTimer; // pussywizard
     uint8 m_additionalSaveMask; // pussywizard
+
+    // What the last SaveToDB() wrote, so unchanged subsystems can be skipped
+    EntryPointData m_savedEntryPointData;
+    bool m_entryPointSaved;
+    bool m_hasSavedAuras;
+    bool m_hasSavedSpellCooldowns;
+    bool m_instanceResetTimesChanged;
+    std::unordered_set<std::string> m_changedCharSettings;
+    uint32 m_saveStatementsAvoided;
     uint16 m_hostileReferenceCheckTimer; // pussywizard
     std::array<ChatFloodThrottle, ChatFloodThrottle::MAX> m_chatFloodData;
     Difficulty m_dungeonDifficulty;
@@ -151,9 +151,17 @@ void Player::_SavePlayerSettings(CharacterDatabaseTransaction trans)
         if (settings.empty())
             continue;
 
+        if (!m_changedCharSettings.contains(source))
+        {
+            ++m_saveStatementsAvoided;
+            continue;
+        }
+
         CharacterDatabasePreparedStatement* stmt = PlayerSettingsStore::PrepareReplaceStatement(GetGUID().GetCounter(), source, settings);
         trans->Append(stmt);
     }
+
+    m_changedCharSettings.clear();
 }
 
 void Player::UpdatePlayerSetting(std::string const& source, uint32 index, uint32 value)
@@ -161,6 +169,8 @@ void Player::UpdatePlayerSetting(std::string const& source, uint32 index, uint32
     auto it = m_charSettingsMap.find(source);
     size_t const requiredSize = static_cast<size_t>(index) + 1;
 
+    m_changedCharSettings.insert(source);
+
     if (it == m_charSettingsMap.end())
     {
         // Settings not found, create new vector of appropriate size
@@ -42,6 +42,7 @@
 #include "LootItemStorage.h"
 #include "MailMgr.h"
 #include "MapMgr.h"
+#include "Metric.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
@@ -6304,7 +6305,7 @@ void Player::_LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mail
             if (cur_time > m->expire_time)
             {
                 // Drop empty expired mail now; mail with items or money is left
-                // for ReturnOrDeleteOldMails, which owns return-to-sender handling
+                // for the expired mail job, which owns return-to-sender handling
                 if (!has_items && !m->money && !m->COD)
                 {
                     LOG_DEBUG("entities.player", "Player::_LoadMail: Mail ({}) has expired - deleted.", m->messageID);
@@ -7218,6 +7219,8 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logo
     m_additionalSaveTimer = 0;
     m_additionalSaveMask = 0;
 
+    m_saveStatementsAvoided = 0;
+
     // first save/honor gain after midnight will also update the player's honor fields
     UpdateHonorFields();
 
@@ -7261,6 +7264,9 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logo
     // save pet (hunter pet level and experience and all type pets health/mana).
     if (Pet* pet = GetPet())
         pet->SavePetToDB(PET_SAVE_AS_CURRENT);
+
+    LOG_DEBUG("entities.player", "Player {} saved, {} statements skipped for unchanged data", GetGUID().ToString(), m_saveStatementsAvoided);
+    METRIC_VALUE("player_save_statements_avoided", uint64(m_saveStatementsAvoided));
 }
 
 // flag data to be saved by UpdateAdditionalSaves a moment after an important change,
@@ -7340,17 +7346,30 @@ void Player::_SaveActions(CharacterDatabaseTransaction trans)
 
 void Player::_SaveAuras(CharacterDatabaseTransaction trans, bool logout)
 {
+    auto canSave = [logout](Aura const* aura)
+    {
+        return aura->CanBeSaved() && (logout || aura->GetDuration() >= 60 * IN_MILLISECONDS);
+    };
+
+    bool const hasAuras = std::any_of(m_ownedAuras.begin(), m_ownedAuras.end(), [&](AuraMap::value_type const& pair) { return canSave(pair.second); });
+
+    // nothing stored and nothing to store, skip the delete
+    if (!hasAuras && !m_hasSavedAuras)
+    {
+        ++m_saveStatementsAvoided;
+        return;
+    }
+
+    m_hasSavedAuras = hasAuras;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
     stmt->SetData(0, GetGUID().GetRawValue());
     trans->Append(stmt);
 
     for (AuraMap::const_iterator itr = m_ownedAuras.begin(); itr != m_ownedAuras.end(); ++itr)
     {
-        if (!itr->second->CanBeSaved())
-            continue;
-
         Aura* aura = itr->second;
-        if (!logout && aura->GetDuration() < 60 * IN_MILLISECONDS )
+        if (!canSave(aura))
             continue;
 
         int32 damage[MAX_SPELL_EFFECTS];
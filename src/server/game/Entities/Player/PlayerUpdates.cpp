@@ -385,7 +385,10 @@ void Player::Update(uint32 p_time)
              itr != _instanceResetTimes.end();)
         {
             if (itr->second < now)
+            {
                 _instanceResetTimes.erase(itr++);
+                m_instanceResetTimesChanged = true;
+            }
             else
                 ++itr;
         }
@@ -1594,18 +1597,6 @@ void Player::UpdatePotionCooldown(Spell* spell)
     SetLastPotionId(0);
 }
 
-template void Player::UpdateVisibilityOf(Player* target, UpdateData& data,
-                                         std::vector<Unit*>& visibleNow);
-template void Player::UpdateVisibilityOf(Creature* target, UpdateData& data,
-                                         std::vector<Unit*>& visibleNow);
-template void Player::UpdateVisibilityOf(Corpse* target, UpdateData& data,
-                                         std::vector<Unit*>& visibleNow);
-template void Player::UpdateVisibilityOf(GameObject* target, UpdateData& data,
-                                         std::vector<Unit*>& visibleNow);
-template void Player::UpdateVisibilityOf(DynamicObject*      target,
-                                         UpdateData&         data,
-                                         std::vector<Unit*>& visibleNow);
-
 void Player::UpdateVisibilityForPlayer(bool mapChange)
 {
     // After added to map seer must be a player - there is no possibility to
@@ -1642,36 +1633,6 @@ void Player::UpdateObjectVisibility(bool forced, bool fromUpdate)
     }
 }
 
-template <class T>
-inline void UpdateVisibilityOf_helper(Player* player, T* target,
-                                      std::vector<Unit*>& /*v*/)
-{
-    player->GetObjectVisibilityContainer().LinkWorldObjectVisibility(target);
-}
-
-template <>
-inline void UpdateVisibilityOf_helper(Player* player, GameObject* target,
-                                      std::vector<Unit*>& /*v*/)
-{
-    player->GetObjectVisibilityContainer().LinkWorldObjectVisibility(target);
-}
-
-template <>
-inline void UpdateVisibilityOf_helper(Player* player, Creature* target,
-                                      std::vector<Unit*>& v)
-{
-    player->GetObjectVisibilityContainer().LinkWorldObjectVisibility(target);
-    v.push_back(target);
-}
-
-template <>
-inline void UpdateVisibilityOf_helper(Player* player, Player* target,
-                                      std::vector<Unit*>& v)
-{
-    player->GetObjectVisibilityContainer().LinkWorldObjectVisibility(target);
-    v.push_back(target);
-}
-
 template <class T>
 inline void BeforeVisibilityDestroy(T* /*t*/, Player* /*p*/)
 {
@@ -1684,30 +1645,23 @@ inline void BeforeVisibilityDestroy<Creature>(Creature* t, Player* p)
         ((Pet*) t)->Remove(PET_SAVE_NOT_IN_SLOT, true);
 }
 
-template <class T>
-void Player::UpdateVisibilityOf(T* target, UpdateData& data,
-                                std::vector<Unit*>& visibleNow)
+void Player::CreateVisibleObject(WorldObject* target, UpdateData& data, std::vector<Unit*>& visibleNow)
 {
-    GetMap()->AddObjectToPendingUpdateList(target);
+    target->BuildCreateUpdateBlockForPlayer(&data, this);
+    GetObjectVisibilityContainer().LinkWorldObjectVisibility(target);
 
-    if (HaveAtClient(target))
-    {
-        if (!CanSeeOrDetect(target, false, true))
-        {
-            BeforeVisibilityDestroy<T>(target, this);
+    // initial aura and melee packets are sent after the create block
+    if (Unit* unit = target->ToUnit())
+        visibleNow.push_back(unit);
+}
 
-            target->BuildOutOfRangeUpdateBlock(&data);
-            GetObjectVisibilityContainer().UnlinkWorldObjectVisibility(target);
-        }
-    }
-    else
-    {
-        if (CanSeeOrDetect(target, false, true))
-        {
-            target->BuildCreateUpdateBlockForPlayer(&data, this);
-            UpdateVisibilityOf_helper(this, target, visibleNow);
-        }
-    }
+void Player::DestroyVisibleObject(WorldObject* target, UpdateData& data)
+{
+    if (target->IsCreature())
+        BeforeVisibilityDestroy<Creature>(target->ToCreature(), this);
+
+    target->BuildOutOfRangeUpdateBlock(&data);
+    GetObjectVisibilityContainer().UnlinkWorldObjectVisibility(target);
 }
 
 void Player::GetInitialVisiblePackets(Unit* target)
@@ -1822,7 +1776,7 @@ void Player::UpdateForQuestWorldObjects()
                 {
                     //! This code doesn't look right, but it was logically converted to condition system to do the exact
                     //! same thing it did before. It definitely needs to be overlooked for intended functionality.
-                    ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(obj->GetEntry(), _itr->second.spellId);
+                    ConditionList const& conds = sConditionMgr->GetConditionsForSpellClickEvent(obj->GetEntry(), _itr->second.spellId);
                     bool buildUpdateBlock = false;
                     for (ConditionList::const_iterator jtr = conds.begin(); jtr != conds.end() && !buildUpdateBlock; ++jtr)
                         if ((*jtr)->ConditionType == CONDITION_QUESTREWARDED || (*jtr)->ConditionType == CONDITION_QUESTTAKEN)
@@ -502,34 +502,39 @@ void MotionTransport::LoadStaticPassengers()
     SetPassengersLoaded(true);
     if (uint32 mapId = GetGOInfo()->moTransport.mapID)
     {
+        // Creating passengers can run scripts that add or remove spawns (invalidating iterators
+        // into the flat sets and the cell map), so collect the guids first, like the grid loader does
+        std::vector<ObjectGuid::LowType> creatureGuids;
+        std::vector<ObjectGuid::LowType> gameobjectGuids;
+
         CellObjectGuidsMap const& cells = sObjectMgr->GetMapObjectGuids(mapId, GetMap()->GetSpawnMode());
-        CellGuidSet::const_iterator guidEnd;
         for (CellObjectGuidsMap::const_iterator cellItr = cells.begin(); cellItr != cells.end(); ++cellItr)
         {
-            // Creatures on transport
-            guidEnd = cellItr->second.creatures.end();
-            for (CellGuidSet::const_iterator guidItr = cellItr->second.creatures.begin(); guidItr != guidEnd; ++guidItr)
-            {
-                CreatureData const* data = sObjectMgr->GetCreatureData(*guidItr);
+            creatureGuids.insert(creatureGuids.end(), cellItr->second.creatures.begin(), cellItr->second.creatures.end());
+            gameobjectGuids.insert(gameobjectGuids.end(), cellItr->second.gameobjects.begin(), cellItr->second.gameobjects.end());
+        }
 
-                // Pooled spawns are in the grid data but managed by the pool system, never as static passengers
-                if (data && data->poolId)
-                    continue;
+        // Creatures on transport
+        for (ObjectGuid::LowType const& guid : creatureGuids)
+        {
+            CreatureData const* data = sObjectMgr->GetCreatureData(guid);
 
-                CreateNPCPassenger(*guidItr, data);
-            }
+            // Pooled spawns are in the grid data but managed by the pool system, never as static passengers
+            if (data && data->poolId)
+                continue;
 
-            // GameObjects on transport
-            guidEnd = cellItr->second.gameobjects.end();
-            for (CellGuidSet::const_iterator guidItr = cellItr->second.gameobjects.begin(); guidItr != guidEnd; ++guidItr)
-            {
-                GameObjectData const* data = sObjectMgr->GetGameObjectData(*guidItr);
+            CreateNPCPassenger(guid, data);
+        }
 
-                if (data && data->poolId)
-                    continue;
+        // GameObjects on transport
+        for (ObjectGuid::LowType const& guid : gameobjectGuids)
+        {
+            GameObjectData const* data = sObjectMgr->GetGameObjectData(guid);
 
-                CreateGOPassenger(*guidItr, data);
-            }
+            if (data && data->poolId)
+                continue;
+
+            CreateGOPassenger(guid, data);
         }
     }
 }
@@ -2495,6 +2495,8 @@ void ObjectMgr::LoadCreatures()
         if (gameEvent == 0)
             AddCreatureToGrid(spawnId, &data);
 
+        _spawnSpatialIndex.Insert(&data);
+
         ++count;
     } while (result->NextRow());
 
@@ -2597,6 +2599,7 @@ CreatureData const* ObjectMgr::LoadCreatureDataFromDB(ObjectGuid::LowType spawnI
     }
 
     CreatureData& creatureData    = _creatureDataStore[spawnId];
+    creatureData.spawnId          = spawnId;
     creatureData.id               = creatureId;
     creatureData.mapid            = fields[2].Get<uint16>();
     creatureData.equipmentId      = fields[3].Get<int8>();
@@ -2668,7 +2671,7 @@ CreatureData const* ObjectMgr::LoadCreatureDataFromDB(ObjectGuid::LowType spawnI
     if (!mapEntry)
     {
         LOG_ERROR("sql.sql", "Table `creature` has creature (SpawnId: {}) that spawned at non-existing map (Id: {}), skipped.", spawnId, creatureData.mapid);
-        _creatureDataStore.erase(spawnId);
+        EraseCreatureData(spawnId);
         return nullptr;
     }
 
@@ -2688,7 +2691,7 @@ CreatureData const* ObjectMgr::LoadCreatureDataFromDB(ObjectGuid::LowType spawnI
 
     if (!ok)
     {
-        _creatureDataStore.erase(spawnId);
+        EraseCreatureData(spawnId);
         return nullptr;
     }
 
@@ -2741,6 +2744,8 @@ CreatureData const* ObjectMgr::LoadCreatureDataFromDB(ObjectGuid::LowType spawnI
         creatureData.phaseMask = 1;
     }
 
+    _spawnSpatialIndex.Insert(&creatureData);
+
     return &creatureData;
 }
 
@@ -2842,6 +2847,7 @@ ObjectGuid::LowType ObjectMgr::AddGOData(uint32 entry, uint32 mapId, float x, fl
     data.spawnGroupId   = 0;
 
     AddGameobjectToGrid(spawnId, &data);
+    _spawnSpatialIndex.Insert(&data);
 
     // Spawn if necessary (loaded grids only)
     // We use spawn coords to spawn
@@ -2901,6 +2907,7 @@ ObjectGuid::LowType ObjectMgr::AddCreData(uint32 entry, uint32 mapId, float x, f
     data.dynamicflags = cInfo->dynamicflags;
 
     AddCreatureToGrid(spawnId, &data);
+    _spawnSpatialIndex.Insert(&data);
 
     // Spawn if necessary (loaded grids only)
     if (!map->Instanceable() && map->IsGridLoaded(x, y))
@@ -3097,6 +3104,8 @@ void ObjectMgr::LoadGameobjects()
 
         if (gameEvent == 0)                      // if not this is to be managed by GameEvent System
             AddGameobjectToGrid(guid, &data);
+
+        _spawnSpatialIndex.Insert(&data);
     } while (result->NextRow());
 
     LOG_INFO("server.loading", ">> Loaded {} Gameobjects in {} ms", (unsigned long)_gameObjectDataStore.size(), GetMSTimeDiffToNow(oldMSTime));
@@ -3138,6 +3147,7 @@ GameObjectData const* ObjectMgr::LoadGameObjectDataFromDB(ObjectGuid::LowType sp
     }
 
     GameObjectData& goData  = _gameObjectDataStore[spawnId];
+    goData.spawnId          = spawnId;
     goData.id               = entry;
     goData.mapid            = fields[2].Get<uint16>();
     goData.posX             = fields[3].Get<float>();
@@ -3160,7 +3170,7 @@ GameObjectData const* ObjectMgr::LoadGameObjectDataFromDB(ObjectGuid::LowType sp
     if (!mapEntry)
     {
         LOG_ERROR("sql.sql", "Table `gameobject` has gameobject (GUID: {} Entry: {}) spawned on a non-existing map (Id: {}), skipped.", spawnId, entry, goData.mapid);
-        _gameObjectDataStore.erase(spawnId);
+        EraseGameObjectData(spawnId);
         return nullptr;
     }
 
@@ -3173,7 +3183,7 @@ GameObjectData const* ObjectMgr::LoadGameObjectDataFromDB(ObjectGuid::LowType sp
     if (go_state >= MAX_GO_STATE)
     {
         LOG_ERROR("sql.sql", "Table `gameobject` has gameobject (GUID: {} Entry: {}) with invalid `state` ({}) value, skipped.", spawnId, entry, go_state);
-        _gameObjectDataStore.erase(spawnId);
+        EraseGameObjectData(spawnId);
         return nullptr;
     }
     goData.go_state = GOState(go_state);
@@ -3184,28 +3194,28 @@ GameObjectData const* ObjectMgr::LoadGameObjectDataFromDB(ObjectGuid::LowType sp
     if (goData.rotation.x < -1.0f || goData.rotation.x > 1.0f)
     {
         LOG_ERROR("sql.sql", "Table `gameobject` has gameobject (GUID: {} Entry: {}) with invalid rotationX ({}) value, skipped.", spawnId, entry, goData.rotation.x);
-        _gameObjectDataStore.erase(spawnId);
+        EraseGameObjectData(spawnId);
         return nullptr;
     }
 
     if (goData.rotation.y < -1.0f || goData.rotation.y > 1.0f)
     {
         LOG_ERROR("sql.sql", "Table `gameobject` has gameobject (GUID: {} Entry: {}) with invalid rotationY ({}) value, skipped.", spawnId, entry, goData.rotation.y);
-        _gameObjectDataStore.erase(spawnId);
+        EraseGameObjectData(spawnId);
         return nullptr;
     }
 
     if (goData.rotation.z < -1.0f || goData.rotation.z > 1.0f)
     {
         LOG_ERROR("sql.sql", "Table `gameobject` has gameobject (GUID: {} Entry: {}) with invalid rotationZ ({}) value, skipped.", spawnId, entry, goData.rotation.z);
-        _gameObjectDataStore.erase(spawnId);
+        EraseGameObjectData(spawnId);
         return nullptr;
     }
 
     if (goData.rotation.w < -1.0f || goData.rotation.w > 1.0f)
     {
         LOG_ERROR("sql.sql", "Table `gameobject` has gameobject (GUID: {} Entry: {}) with invalid rotationW ({}) value, skipped.", spawnId, entry, goData.rotation.w);
-        _gameObjectDataStore.erase(spawnId);
+        EraseGameObjectData(spawnId);
         return nullptr;
     }
 
@@ -3219,7 +3229,7 @@ GameObjectData const* ObjectMgr::LoadGameObjectDataFromDB(ObjectGuid::LowType sp
     if (!MapMgr::IsValidMapCoord(goData.mapid, goData.posX, goData.posY, goData.posZ, goData.orientation))
     {
         LOG_ERROR("sql.sql", "Table `gameobject` has gameobject (GUID: {} Entry: {}) with invalid coordinates, skipped.", spawnId, entry);
-        _gameObjectDataStore.erase(spawnId);
+        EraseGameObjectData(spawnId);
         return nullptr;
     }
 
@@ -3229,6 +3239,8 @@ GameObjectData const* ObjectMgr::LoadGameObjectDataFromDB(ObjectGuid::LowType sp
         goData.phaseMask = 1;
     }
 
+    _spawnSpatialIndex.Insert(&goData);
+
     return &goData;
 }
 
@@ -8637,7 +8649,7 @@ void ObjectMgr::DeleteCreatureData(ObjectGuid::LowType guid)
     if (data)
         RemoveCreatureFromGrid(guid, data);
 
-    _creatureDataStore.erase(guid);
+    EraseCreatureData(guid);
 }
 
 void ObjectMgr::DeleteGOData(ObjectGuid::LowType guid)
@@ -8647,7 +8659,27 @@ void ObjectMgr::DeleteGOData(ObjectGuid::LowType guid)
     if (data)
         RemoveGameobjectFromGrid(guid, data);
 
-    _gameObjectDataStore.erase(guid);
+    EraseGameObjectData(guid);
+}
+
+void ObjectMgr::EraseCreatureData(ObjectGuid::LowType spawnId)
+{
+    auto itr = _creatureDataStore.find(spawnId);
+    if (itr == _creatureDataStore.end())
+        return;
+
+    _spawnSpatialIndex.Remove(&itr->second);
+    _creatureDataStore.erase(itr);
+}
+
+void ObjectMgr::EraseGameObjectData(ObjectGuid::LowType spawnId)
+{
+    auto itr = _gameObjectDataStore.find(spawnId);
+    if (itr == _gameObjectDataStore.end())
+        return;
+
+    _spawnSpatialIndex.Remove(&itr->second);
+    _gameObjectDataStore.erase(itr);
 }
 
 SpawnData const* ObjectMgr::GetSpawnData(SpawnObjectType type, ObjectGuid::LowType spawnId) const
@@ -33,9 +33,11 @@
 #include "ObjectAccessor.h"
 #include "ObjectDefines.h"
 #include "QuestDef.h"
+#include "SpawnSpatialIndex.h"
 #include "TemporarySummon.h"
 #include "Trainer.h"
 #include "VehicleDefines.h"
+#include <boost/container/flat_set.hpp>
 #include <functional>
 #include <limits>
 #include <map>
@@ -475,7 +477,8 @@ struct BroadcastText
 
 typedef std::unordered_map<uint32, BroadcastText> BroadcastTextContainer;
 
-typedef std::set<ObjectGuid::LowType> CellGuidSet;
+// Sorted contiguous storage, walked in full every time a grid loads its spawns
+typedef boost::container::flat_set<ObjectGuid::LowType> CellGuidSet;
 
 struct CellObjectGuids
 {
@@ -1403,6 +1406,10 @@ public:
     void RemoveCreatureFromGrid(ObjectGuid::LowType guid, CreatureData const* data);
     void AddGameobjectToGrid(ObjectGuid::LowType guid, GameObjectData const* data);
     void RemoveGameobjectFromGrid(ObjectGuid::LowType guid, GameObjectData const* data);
+
+    // spawn positions of all maps, must be refreshed whenever a spawn's map or position changes
+    [[nodiscard]] SpawnSpatialIndex const& GetSpawnSpatialIndex() const { return _spawnSpatialIndex; }
+    void UpdateSpawnSpatialIndex(SpawnData const* data) { _spawnSpatialIndex.Insert(data); }
     ObjectGuid::LowType AddGOData(uint32 entry, uint32 map, float x, float y, float z, float o, uint32 spawntimedelay = 0, float rotation0 = 0, float rotation1 = 0, float rotation2 = 0, float rotation3 = 0);
     ObjectGuid::LowType AddCreData(uint32 entry, uint32 map, float x, float y, float z, float o, uint32 spawntimedelay = 0);
 
@@ -1617,6 +1624,9 @@ private:
     void LoadScripts(ScriptsType type);
     void LoadQuestRelationsHelper(QuestRelations& map, std::string const& table, bool starter, bool go);
     void PlayerCreateInfoAddItemHelper(uint32 race_, uint32 class_, uint32 itemId, int32 count);
+    // erase the spawn from its data store and from _spawnSpatialIndex, which points into it
+    void EraseCreatureData(ObjectGuid::LowType spawnId);
+    void EraseGameObjectData(ObjectGuid::LowType spawnId);
 
     MailLevelRewardContainer _mailLevelRewardStore;
 
@@ -1652,6 +1662,7 @@ private:
     ItemSetNameContainer _itemSetNameStore;
 
     MapObjectGuids _mapObjectGuidsStore;
+    SpawnSpatialIndex _spawnSpatialIndex;
     CellObjectGuidsMap _emptyCellObjectGuidsMap;
     CellObjectGuids _emptyCellObjectGuids;
     CreatureDataContainer _creatureDataStore;
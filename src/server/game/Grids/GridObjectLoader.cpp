@@ -39,7 +39,11 @@ void GridObjectLoader::AddObjectHelper(Map* map, T* obj)
 
 void GridObjectLoader::LoadCreatures(CellGuidSet const& guid_set, Map* map)
 {
-    for (ObjectGuid::LowType const& guid : guid_set)
+    // Spawning can run scripts that add or remove spawns in this grid (which would invalidate
+    // iterators into the flat set), and anything added now is spawned by its caller anyway
+    std::vector<ObjectGuid::LowType> const guids(guid_set.begin(), guid_set.end());
+
+    for (ObjectGuid::LowType const& guid : guids)
     {
         // Skip spawns whose spawn group is not active on this map
         CreatureData const* cData = sObjectMgr->GetCreatureData(guid);
@@ -77,7 +81,10 @@ void GridObjectLoader::LoadCreatures(CellGuidSet const& guid_set, Map* map)
 
 void GridObjectLoader::LoadGameObjects(CellGuidSet const& guid_set, Map* map)
 {
-    for (ObjectGuid::LowType const& guid : guid_set)
+    // see LoadCreatures
+    std::vector<ObjectGuid::LowType> const guids(guid_set.begin(), guid_set.end());
+
+    for (ObjectGuid::LowType const& guid : guids)
     {
         GameObjectData const* data = sObjectMgr->GetGameObjectData(guid);
 
@@ -1,6 +1,7 @@
 #include "MapGridManager.h"
 #include "GridObjectLoader.h"
 #include "GridTerrainLoader.h"
+#include "Metric.h"
 
 void MapGridManager::CreateGrid(uint16 const x, uint16 const y)
 {
@@ -36,6 +37,8 @@ bool MapGridManager::LoadGrid(uint16 const x, uint16 const y)
     if (!grid || grid->IsObjectDataLoaded())
         return false;
 
+    METRIC_TIMER("map_grid_load_time", METRIC_TAG("map_id", std::to_string(_map->GetId())));
+
     // Must mark as loaded first, as GridObjectLoader spawning objects can attempt to recursively load the grid
     grid->SetObjectDataLoaded();
 
@@ -21,16 +21,20 @@
 #include "Transport.h"
 #include "UpdateData.h"
 #include "WorldPacket.h"
+#include <algorithm>
 
 using namespace Acore;
 
 void VisibleNotifier::Visit(GameObjectMapType& m)
 {
     for (GameObjectMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
-    {
-        GameObject* go = iter->GetSource();
-        i_player.UpdateVisibilityOf(go, i_data, i_visibleNow);
-    }
+        AddCandidate(iter->GetSource());
+}
+
+void VisibleNotifier::AddCandidate(WorldObject* target)
+{
+    i_player.GetMap()->AddObjectToPendingUpdateList(target);
+    i_candidates.push_back({ target->GetGUID(), target, i_player.CanSeeOrDetect(target, false, true), VisibilityChange::None });
 }
 
 void VisibleNotifier::SendToSelf()
@@ -44,13 +48,9 @@ void VisibleNotifier::SendToSelf()
             switch (obj->GetTypeId())
             {
                 case TYPEID_GAMEOBJECT:
-                    i_player.UpdateVisibilityOf(obj->ToGameObject(), i_data, i_visibleNow);
-                    break;
                 case TYPEID_UNIT:
-                    i_player.UpdateVisibilityOf(obj->ToCreature(), i_data, i_visibleNow);
-                    break;
                 case TYPEID_DYNAMICOBJECT:
-                    i_player.UpdateVisibilityOf(obj->ToDynObject(), i_data, i_visibleNow);
+                    AddCandidate(obj);
                     break;
                 default:
                     break;
@@ -58,24 +58,65 @@ void VisibleNotifier::SendToSelf()
         }
     }
 
-    VisibleWorldObjectsMap* visibleWorldObjects = i_player.GetObjectVisibilityContainer().GetVisibleWorldObjectsMap();
-    for (VisibleWorldObjectsMap::iterator itr = visibleWorldObjects->begin(); itr != visibleWorldObjects->end();)
+    // Far visible and zone wide objects may have been visited twice
+    std::sort(i_candidates.begin(), i_candidates.end(), [](VisibilityCandidate const& a, VisibilityCandidate const& b) { return a.Guid < b.Guid; });
+    i_candidates.erase(std::unique(i_candidates.begin(), i_candidates.end(), [](VisibilityCandidate const& a, VisibilityCandidate const& b) { return a.Guid == b.Guid; }), i_candidates.end());
+
+    // Merge the candidates with the objects at client, both are sorted by guid. Objects at client
+    // that were not visited are appended as they are found, linking and unlinking only happens
+    // afterwards since it reshapes the visible map.
+    VisibleWorldObjectsMap const& visibleWorldObjects = *i_player.GetObjectVisibilityContainer().GetVisibleWorldObjectsMap();
+    VisibleWorldObjectsMap::const_iterator atClient = visibleWorldObjects.begin();
+
+    auto checkNotVisited = [this](WorldObject* obj)
     {
-        WorldObject* obj = itr->second;
-        if (!i_player.IsWorldObjectOutOfSightRange(obj)
-            || i_player.CanSeeOrDetect(obj, false, true))
+        if (i_player.IsWorldObjectOutOfSightRange(obj) && !i_player.CanSeeOrDetect(obj, false, true))
+            i_candidates.push_back({ obj->GetGUID(), obj, false, VisibilityChange::LeaveFar });
+    };
+
+    std::size_t const visited = i_candidates.size();
+    for (std::size_t i = 0; i < visited; ++i)
+    {
+        ObjectGuid const guid = i_candidates[i].Guid;
+        for (; atClient != visibleWorldObjects.end() && atClient->first < guid; ++atClient)
+            checkNotVisited(atClient->second);
+
+        bool haveAtClient = guid == i_player.GetGUID();
+        if (atClient != visibleWorldObjects.end() && atClient->first == guid)
         {
-            ++itr;
-            continue;
+            haveAtClient = true;
+            ++atClient;
         }
 
-        i_data.AddOutOfRangeGUID(obj->GetGUID());
+        VisibilityCandidate& candidate = i_candidates[i];
+        if (candidate.Visible != haveAtClient)
+            candidate.Change = candidate.Visible ? VisibilityChange::Enter : VisibilityChange::Leave;
+    }
 
-        if (Player* objPlayer = obj->ToPlayer())
-            objPlayer->UpdateVisibilityOf(&i_player);
+    for (; atClient != visibleWorldObjects.end(); ++atClient)
+        checkNotVisited(atClient->second);
 
-        // Clean up references
-        itr = i_player.GetObjectVisibilityContainer().UnlinkVisibilityFromPlayer(obj, itr);
+    for (VisibilityCandidate const& candidate : i_candidates)
+    {
+        switch (candidate.Change)
+        {
+            case VisibilityChange::Enter:
+                i_player.CreateVisibleObject(candidate.Object, i_data, i_visibleNow);
+                break;
+            case VisibilityChange::Leave:
+                i_player.DestroyVisibleObject(candidate.Object, i_data);
+                break;
+            case VisibilityChange::LeaveFar:
+                i_data.AddOutOfRangeGUID(candidate.Guid);
+
+                if (Player* objPlayer = candidate.Object->ToPlayer())
+                    objPlayer->UpdateVisibilityOf(&i_player);
+
+                i_player.GetObjectVisibilityContainer().UnlinkWorldObjectVisibility(candidate.Object);
+                break;
+            default:
+                break;
+        }
     }
 
     if (!i_data.HasData())
@@ -149,7 +190,7 @@ void PlayerRelocationNotifier::Visit(PlayerMapType& m)
     for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
     {
         Player* player = iter->GetSource();
-        i_player.UpdateVisibilityOf(player, i_data, i_visibleNow);
+        AddCandidate(player);
         player->UpdateVisibilityOf(&i_player); // this notifier with different Visit(PlayerMapType&) than VisibleNotifier is needed to update visibility of self for other players when we move (eg. stealth detection changes)
     }
 }
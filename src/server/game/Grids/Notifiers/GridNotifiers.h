@@ -40,22 +40,27 @@ class Player;
 
 namespace Acore
 {
+    // Collects every object in range as a candidate, SendToSelf() then diffs the
+    // guid sorted candidates against the player's visible objects in a single pass
     struct VisibleNotifier
     {
         Player& i_player;
         std::vector<Unit*>& i_visibleNow;
+        VisibilityCandidateList& i_candidates;
         bool i_gobjOnly;
         UpdateData i_data;
 
         VisibleNotifier(Player& player, bool gobjOnly) :
-            i_player(player), i_visibleNow(player.m_newVisible), i_gobjOnly(gobjOnly)
+            i_player(player), i_visibleNow(player.m_newVisible), i_candidates(player.m_visibilityCandidates), i_gobjOnly(gobjOnly)
         {
             i_visibleNow.clear();
+            i_candidates.clear();
         }
 
         void Visit(GameObjectMapType&);
         template<class T> void Visit(std::vector<T>& m);
         template<class T> void Visit(GridRefMgr<T>& m);
+        void AddCandidate(WorldObject* target);
         void SendToSelf(void);
     };
 
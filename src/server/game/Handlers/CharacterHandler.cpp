@@ -808,6 +808,23 @@ void WorldSession::HandlePlayerLoginFromDB(LoginQueryHolder const& holder)
 {
     ObjectGuid playerGuid = holder.GetGuid();
 
+    METRIC_VALUE("player_login_query_time", uint64(holder.GetExecutionTime().count()));
+
+    if (sLog->ShouldLog("sql.sql", LogLevel::LOG_LEVEL_DEBUG))
+    {
+        Microseconds statementTotal = Microseconds::zero();
+        std::size_t slowestIndex = 0;
+        for (std::size_t i = 0; i < holder.GetSize(); ++i)
+        {
+            statementTotal += holder.GetQueryTime(i);
+            if (holder.GetQueryTime(i) > holder.GetQueryTime(slowestIndex))
+                slowestIndex = i;
+        }
+
+        LOG_DEBUG("sql.sql", "Login query holder for {} finished in {} us wall time ({} us spent in statements, slowest is index {} with {} us)",
+            playerGuid.ToString(), holder.GetExecutionTime().count(), statementTotal.count(), slowestIndex, holder.GetQueryTime(slowestIndex).count());
+    }
+
     Player* pCurrChar = new Player(this);
     // for send server info and strings (config)
     ChatHandler chH = ChatHandler(pCurrChar->GetSession());
@@ -410,7 +410,11 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recvData)
     /* process position-change */
     WorldPacket data(opcode, recvData.size());
     WriteMovementInfo(&data, &movementInfo);
-    mover->SendMessageToSet(&data, _player);
+
+    if (opcode == MSG_MOVE_HEARTBEAT)
+        mover->SendMovementHeartbeatToSet(&data, _player);
+    else
+        mover->SendMessageToSet(&data, _player);
 }
 
 void WorldSession::SynchronizeMovement(MovementInfo& movementInfo)
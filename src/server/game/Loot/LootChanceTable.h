@@ -0,0 +1,52 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_LOOT_CHANCE_TABLE_H
+#define ACORE_LOOT_CHANCE_TABLE_H
+
+#include "Define.h"
+#include <algorithm>
+#include <vector>
+
+/**
+ * Running sums of the explicit chances of a loot group, built once at load.
+ *
+ * Select() picks the same entry as walking the group in order and subtracting
+ * each chance from the roll until it drops below zero, but in O(log n).
+ * An entry with chance >= 100 is still taken whenever the walk reaches it,
+ * since its running sum always exceeds a roll in [0, 100).
+ */
+class LootChanceTable
+{
+public:
+    void Add(float chance) { _sums.push_back(_sums.empty() ? chance : _sums.back() + chance); }
+    void Clear() { _sums.clear(); }
+
+    [[nodiscard]] std::size_t GetSize() const { return _sums.size(); }
+    [[nodiscard]] float GetTotalChance() const { return _sums.empty() ? 0.0f : _sums.back(); }
+
+    /// Index of the entry hit by the roll, GetSize() if the roll misses every entry
+    [[nodiscard]] std::size_t Select(float roll) const
+    {
+        return std::size_t(std::upper_bound(_sums.begin(), _sums.end(), roll) - _sums.begin());
+    }
+
+private:
+    std::vector<float> _sums;
+};
+
+#endif
@@ -21,6 +21,7 @@
 #include "Group.h"
 #include "ItemEnchantmentMgr.h"
 #include "Log.h"
+#include "LootChanceTable.h"
 #include "ObjectMgr.h"
 #include "Player.h"
 #include "ScriptMgr.h"
@@ -98,6 +99,7 @@ public:
     ~LootGroup();
 
     void AddEntry(LootStoreItem* item);                     // Adds an entry to the group (at loading stage)
+    void Compile();                                         // Builds the roll tables (at loading stage, after all entries are added)
     bool HasQuestDrop(LootTemplateMap const& store) const;  // True if group includes at least 1 quest drop entry
     bool HasQuestDropForPlayer(Player const* player, LootTemplateMap const& store) const;
     // The same for active quests of the player
@@ -108,13 +110,17 @@ public:
     void Verify(LootStore const& lootstore, uint32 id, uint8 group_id) const;
     void CollectLootIds(LootIdSet& set) const;
     void CheckLootRefs(LootStore const& lootstore, uint32 Id, LootIdSet* ref_set) const;
-    LootStoreItemList* GetExplicitlyChancedItemList() { return &ExplicitlyChanced; }
-    LootStoreItemList* GetEqualChancedItemList() { return &EqualChanced; }
+    LootStoreItemVector* GetExplicitlyChancedItemList() { return &ExplicitlyChanced; }
+    LootStoreItemVector* GetEqualChancedItemList() { return &EqualChanced; }
     void CopyConditions(ConditionList conditions);
 private:
-    LootStoreItemList ExplicitlyChanced;                // Entries with chances defined in DB
-    LootStoreItemList EqualChanced;                     // Zero chances - every entry takes the same chance
+    LootStoreItemVector ExplicitlyChanced;              // Entries with chances defined in DB
+    LootStoreItemVector EqualChanced;                   // Zero chances - every entry takes the same chance
+    LootChanceTable ExplicitChances;                    // Running sums of ExplicitlyChanced chances
+    uint16 CommonLootMode = 0;                          // Loot mode bits shared by every entry of the group
+    uint8 GroupId = 0;
 
+    bool CanUseChanceTable(Loot const& loot, uint16 lootMode) const;
     LootStoreItem const* Roll(Loot& loot, Player const* player, LootStore const& store, uint16 lootMode) const;   // Rolls an item from the group, returns nullptr if all miss their chances
 
     // This class must never be copied - storing pointers
@@ -212,6 +218,9 @@ uint32 LootStore::LoadLootTable()
 
     Verify();                                           // Checks validity of the loot store
 
+    for (LootTemplateMap::const_iterator itr = m_LootTemplates.begin(); itr != m_LootTemplates.end(); ++itr)
+        itr->second->Compile();
+
     return count;
 }
 
@@ -1258,19 +1267,67 @@ void LootTemplate::LootGroup::AddEntry(LootStoreItem* item)
         EqualChanced.push_back(item);
 }
 
+// Builds the roll tables (at loading stage, after all entries are added)
+void LootTemplate::LootGroup::Compile()
+{
+    ExplicitChances.Clear();
+    CommonLootMode = 0xFFFF;
+
+    for (LootStoreItem const* item : ExplicitlyChanced)
+    {
+        ExplicitChances.Add(item->chance);
+        CommonLootMode &= item->lootmode;
+        GroupId = item->groupid;
+    }
+
+    for (LootStoreItem const* item : EqualChanced)
+    {
+        CommonLootMode &= item->lootmode;
+        GroupId = item->groupid;
+    }
+}
+
+// True if no entry of the group can be filtered out by LootGroupInvalidSelector,
+// so the precomputed tables describe exactly the entries the roll has to consider
+bool LootTemplate::LootGroup::CanUseChanceTable(Loot const& loot, uint16 lootMode) const
+{
+    if (!(CommonLootMode & lootMode))
+        return false;
+
+    // Duplicate limits only apply once an item of this group already dropped
+    for (LootItem const& lootItem : loot.items)
+        if (lootItem.groupid == GroupId)
+            return false;
+
+    // Scripts may change the chance of each entry
+    return !sScriptMgr->HasItemRollHooks();
+}
+
 // Rolls an item from the group, returns nullptr if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll(Loot& loot, Player const* player, LootStore const& store, uint16 lootMode) const
 {
-    LootStoreItemList possibleLoot = ExplicitlyChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
+    bool const useTable = CanUseChanceTable(loot, lootMode);
+    LootGroupInvalidSelector isInvalid(loot, lootMode);
 
-    if (!possibleLoot.empty())                             // First explicitly chanced entries are checked
+    if (useTable)
+    {
+        if (!ExplicitlyChanced.empty())
+        {
+            std::size_t index = ExplicitChances.Select((float)rand_chance());
+            if (index < ExplicitlyChanced.size())
+                return ExplicitlyChanced[index];
+        }
+    }
+    else if (std::any_of(ExplicitlyChanced.begin(), ExplicitlyChanced.end(), [&](LootStoreItem* item) { return !isInvalid(item); }))
     {
+        // First explicitly chanced entries are checked
         float roll = (float)rand_chance();
 
-        for (LootStoreItemList::const_iterator itr = possibleLoot.begin(); itr != possibleLoot.end(); ++itr)   // check each explicitly chanced entry in the template and modify its chance based on quality.
+        for (LootStoreItem* item : ExplicitlyChanced)   // check each explicitly chanced entry in the template and modify its chance based on quality.
         {
-            LootStoreItem* item = *itr;
+            if (isInvalid(item))
+                continue;
+
             float chance = item->chance;
 
             if (!sScriptMgr->OnItemRoll(player, item, chance, loot, store))
@@ -1288,18 +1345,29 @@ LootStoreItem const* LootTemplate::LootGroup::Roll(Loot& loot, Player const* pla
     if (!sScriptMgr->OnBeforeLootEqualChanced(player, EqualChanced, loot, store))
         return nullptr;
 
-    possibleLoot = EqualChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
-    if (!possibleLoot.empty())                              // If nothing selected yet - an item is taken from equal-chanced part
-        return Acore::Containers::SelectRandomContainerElement(possibleLoot);
+    if (EqualChanced.empty())
+        return nullptr;                                        // Empty drop from the group
+
+    // If nothing selected yet - an item is taken from equal-chanced part
+    if (useTable)
+        return Acore::Containers::SelectRandomContainerElement(EqualChanced);
+
+    uint32 validCount = uint32(std::count_if(EqualChanced.begin(), EqualChanced.end(), [&](LootStoreItem* item) { return !isInvalid(item); }));
+    if (!validCount)
+        return nullptr;                                        // Empty drop from the group
+
+    uint32 selected = urand(0, validCount - 1);
+    for (LootStoreItem* item : EqualChanced)
+        if (!isInvalid(item) && !selected--)
+            return item;
 
-    return nullptr;                                            // Empty drop from the group
+    return nullptr;
 }
 
 // True if group includes at least 1 quest drop entry
 bool LootTemplate::LootGroup::HasQuestDrop(LootTemplateMap const& store) const
 {
-    for (LootStoreItemList::const_iterator i = ExplicitlyChanced.begin(); i != ExplicitlyChanced.end(); ++i)
+    for (LootStoreItemVector::const_iterator i = ExplicitlyChanced.begin(); i != ExplicitlyChanced.end(); ++i)
     {
         LootStoreItem* item = *i;
         if (item->reference) // References
@@ -1321,7 +1389,7 @@ bool LootTemplate::LootGroup::HasQuestDrop(LootTemplateMap const& store) const
         }
     }
 
-    for (LootStoreItemList::const_iterator i = EqualChanced.begin(); i != EqualChanced.end(); ++i)
+    for (LootStoreItemVector::const_iterator i = EqualChanced.begin(); i != EqualChanced.end(); ++i)
     {
         LootStoreItem* item = *i;
         if (item->reference) // References
@@ -1349,7 +1417,7 @@ bool LootTemplate::LootGroup::HasQuestDrop(LootTemplateMap const& store) const
 // True if group includes at least 1 quest drop entry for active quests of the player
 bool LootTemplate::LootGroup::HasQuestDropForPlayer(Player const* player, LootTemplateMap const& store) const
 {
-    for (LootStoreItemList::const_iterator i = ExplicitlyChanced.begin(); i != ExplicitlyChanced.end(); ++i)
+    for (LootStoreItemVector::const_iterator i = ExplicitlyChanced.begin(); i != ExplicitlyChanced.end(); ++i)
     {
         LootStoreItem* item = *i;
         if (item->reference)                        // References processing
@@ -1371,7 +1439,7 @@ bool LootTemplate::LootGroup::HasQuestDropForPlayer(Player const* player, LootTe
         }
     }
 
-    for (LootStoreItemList::const_iterator i = EqualChanced.begin(); i != EqualChanced.end(); ++i)
+    for (LootStoreItemVector::const_iterator i = EqualChanced.begin(); i != EqualChanced.end(); ++i)
     {
         LootStoreItem* item = *i;
         if (item->reference)                        // References processing
@@ -1398,10 +1466,10 @@ bool LootTemplate::LootGroup::HasQuestDropForPlayer(Player const* player, LootTe
 
 void LootTemplate::LootGroup::CopyConditions(ConditionList /*conditions*/)
 {
-    for (LootStoreItemList::iterator i = ExplicitlyChanced.begin(); i != ExplicitlyChanced.end(); ++i)
+    for (LootStoreItemVector::iterator i = ExplicitlyChanced.begin(); i != ExplicitlyChanced.end(); ++i)
         (*i)->conditions.clear();
 
-    for (LootStoreItemList::iterator i = EqualChanced.begin(); i != EqualChanced.end(); ++i)
+    for (LootStoreItemVector::iterator i = EqualChanced.begin(); i != EqualChanced.end(); ++i)
         (*i)->conditions.clear();
 }
 
@@ -1446,7 +1514,7 @@ float LootTemplate::LootGroup::RawTotalChance() const
 {
     float result = 0;
 
-    for (LootStoreItemList::const_iterator i = ExplicitlyChanced.begin(); i != ExplicitlyChanced.end(); ++i)
+    for (LootStoreItemVector::const_iterator i = ExplicitlyChanced.begin(); i != ExplicitlyChanced.end(); ++i)
         if (!(*i)->needs_quest)
             result += (*i)->chance;
 
@@ -1480,7 +1548,7 @@ void LootTemplate::LootGroup::Verify(LootStore const& lootstore, uint32 id, uint
 
 void LootTemplate::LootGroup::CheckLootRefs(LootStore const& lootstore, uint32 Id, LootIdSet* ref_set) const
 {
-    for (LootStoreItemList::const_iterator ieItr = ExplicitlyChanced.begin(); ieItr != ExplicitlyChanced.end(); ++ieItr)
+    for (LootStoreItemVector::const_iterator ieItr = ExplicitlyChanced.begin(); ieItr != ExplicitlyChanced.end(); ++ieItr)
     {
         LootStoreItem* item = *ieItr;
         if (item->reference)
@@ -1495,7 +1563,7 @@ void LootTemplate::LootGroup::CheckLootRefs(LootStore const& lootstore, uint32 I
         }
     }
 
-    for (LootStoreItemList::const_iterator ieItr = EqualChanced.begin(); ieItr != EqualChanced.end(); ++ieItr)
+    for (LootStoreItemVector::const_iterator ieItr = EqualChanced.begin(); ieItr != EqualChanced.end(); ++ieItr)
     {
         LootStoreItem* item = *ieItr;
         if (item->reference)
@@ -1549,9 +1617,17 @@ void LootTemplate::AddEntry(LootStoreItem* item)
         Entries.push_back(item);
 }
 
+// Builds the roll tables of the groups, called once all entries are added
+void LootTemplate::Compile()
+{
+    for (LootGroup* group : Groups)
+        if (group)
+            group->Compile();
+}
+
 void LootTemplate::CopyConditions(ConditionList conditions)
 {
-    for (LootStoreItemList::iterator i = Entries.begin(); i != Entries.end(); ++i)
+    for (LootStoreItemVector::iterator i = Entries.begin(); i != Entries.end(); ++i)
         (*i)->conditions.clear();
 
     for (LootGroups::iterator i = Groups.begin(); i != Groups.end(); ++i)
@@ -1561,7 +1637,7 @@ void LootTemplate::CopyConditions(ConditionList conditions)
 
 bool LootTemplate::CopyConditions(LootItem* li, uint32 conditionLootId) const
 {
-    for (LootStoreItemList::const_iterator _iter = Entries.begin(); _iter != Entries.end(); ++_iter)
+    for (LootStoreItemVector::const_iterator _iter = Entries.begin(); _iter != Entries.end(); ++_iter)
     {
         LootStoreItem* item = *_iter;
         if (item->reference)
@@ -1597,8 +1673,8 @@ bool LootTemplate::CopyConditions(LootItem* li, uint32 conditionLootId) const
         if (!group)
             continue;
 
-        LootStoreItemList* itemList = group->GetExplicitlyChancedItemList();
-        for (LootStoreItemList::iterator i = itemList->begin(); i != itemList->end(); ++i)
+        LootStoreItemVector* itemList = group->GetExplicitlyChancedItemList();
+        for (LootStoreItemVector::iterator i = itemList->begin(); i != itemList->end(); ++i)
         {
             LootStoreItem* item = *i;
             if (item->reference)
@@ -1629,7 +1705,7 @@ bool LootTemplate::CopyConditions(LootItem* li, uint32 conditionLootId) const
         }
 
         itemList = group->GetEqualChancedItemList();
-        for (LootStoreItemList::iterator i = itemList->begin(); i != itemList->end(); ++i)
+        for (LootStoreItemVector::iterator i = itemList->begin(); i != itemList->end(); ++i)
         {
             LootStoreItem* item = *i;
             if (item->reference)
@@ -1689,7 +1765,7 @@ void LootTemplate::Process(Loot& loot, LootStore const& store, uint16 lootMode,
     }
 
     // Rolling non-grouped items
-    for (LootStoreItemList::const_iterator i = Entries.begin(); i != Entries.end(); ++i)
+    for (LootStoreItemVector::const_iterator i = Entries.begin(); i != Entries.end(); ++i)
     {
         LootStoreItem* item = *i;
         if (!(item->lootmode & lootMode))                         // Do not add if mode mismatch
@@ -1738,7 +1814,7 @@ void LootTemplate::Process(Loot& loot, LootStore const& store, uint16 lootMode,
 // True if template includes at least 1 quest drop entry
 bool LootTemplate::HasQuestDrop(LootTemplateMap const& store) const
 {
-    for (LootStoreItemList::const_iterator i = Entries.begin(); i != Entries.end(); ++i)
+    for (LootStoreItemVector::const_iterator i = Entries.begin(); i != Entries.end(); ++i)
     {
         LootStoreItem* item = *i;
         if (item->reference)                                // References
@@ -1773,7 +1849,7 @@ bool LootTemplate::HasQuestDrop(LootTemplateMap const& store) const
 bool LootTemplate::HasQuestDropForPlayer(LootTemplateMap const& store, Player const* player) const
 {
     // Checking non-grouped entries
-    for (LootStoreItemList::const_iterator i = Entries.begin(); i != Entries.end(); ++i)
+    for (LootStoreItemVector::const_iterator i = Entries.begin(); i != Entries.end(); ++i)
     {
         LootStoreItem* item = *i;
         if (item->reference)                                // References processing
@@ -1816,7 +1892,7 @@ void LootTemplate::Verify(LootStore const& lootstore, uint32 id) const
 
 void LootTemplate::CheckLootRefs(LootStore const& lootstore, uint32 Id, LootIdSet* ref_set) const
 {
-    for (LootStoreItemList::const_iterator ieItr = Entries.begin(); ieItr != Entries.end(); ++ieItr)
+    for (LootStoreItemVector::const_iterator ieItr = Entries.begin(); ieItr != Entries.end(); ++ieItr)
     {
         LootStoreItem* item = *ieItr;
         if (item->reference)
@@ -1846,7 +1922,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
 
     if (!Entries.empty())
     {
-        for (LootStoreItemList::iterator i = Entries.begin(); i != Entries.end(); ++i)
+        for (LootStoreItemVector::iterator i = Entries.begin(); i != Entries.end(); ++i)
         {
             if ((*i)->itemid == uint32(cond->SourceEntry))
             {
@@ -1864,10 +1940,10 @@ bool LootTemplate::addConditionItem(Condition* cond)
             if (!group)
                 continue;
 
-            LootStoreItemList* itemList = group->GetExplicitlyChancedItemList();
+            LootStoreItemVector* itemList = group->GetExplicitlyChancedItemList();
             if (!itemList->empty())
             {
-                for (LootStoreItemList::iterator i = itemList->begin(); i != itemList->end(); ++i)
+                for (LootStoreItemVector::iterator i = itemList->begin(); i != itemList->end(); ++i)
                 {
                     if ((*i)->itemid == uint32(cond->SourceEntry))
                     {
@@ -1880,7 +1956,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
             itemList = group->GetEqualChancedItemList();
             if (!itemList->empty())
             {
-                for (LootStoreItemList::iterator i = itemList->begin(); i != itemList->end(); ++i)
+                for (LootStoreItemVector::iterator i = itemList->begin(); i != itemList->end(); ++i)
                 {
                     if ((*i)->itemid == uint32(cond->SourceEntry))
                     {
@@ -1896,7 +1972,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
 
 bool LootTemplate::isReference(uint32 id) const
 {
-    for (LootStoreItemList::const_iterator ieItr = Entries.begin(); ieItr != Entries.end(); ++ieItr)
+    for (LootStoreItemVector::const_iterator ieItr = Entries.begin(); ieItr != Entries.end(); ++ieItr)
     {
         if ((*ieItr)->itemid == id && (*ieItr)->reference)
         {
@@ -199,6 +199,7 @@ typedef std::vector<QuestItem> QuestItemList;
 typedef std::vector<LootItem> LootItemList;
 typedef std::map<ObjectGuid, QuestItemList*> QuestItemMap;
 typedef std::list<LootStoreItem*> LootStoreItemList;
+typedef std::vector<LootStoreItem*> LootStoreItemVector;
 typedef std::unordered_map<uint32, LootTemplate*> LootTemplateMap;
 
 typedef std::set<uint32> LootIdSet;
@@ -252,6 +253,8 @@ public:
 
     // Adds an entry to the group (at loading stage)
     void AddEntry(LootStoreItem* item);
+    // Builds the roll tables of the groups, called once all entries are added
+    void Compile();
     // Rolls for every item in the template and adds the rolled items the the loot
     void Process(Loot& loot, LootStore const& store, uint16 lootMode, Player const* player, uint8 groupId = 0, bool isTopLevel = true) const;
     void CopyConditions(ConditionList conditions);
@@ -269,7 +272,7 @@ public:
     [[nodiscard]] bool isReference(uint32 id) const;
 
 private:
-    LootStoreItemList Entries;                          // not grouped only
+    LootStoreItemVector Entries;                        // not grouped only
     LootGroups        Groups;                           // groups have own (optimised) processing, grouped entries go there
 
     // Objects of this class must never be copied, we are storing pointers in container
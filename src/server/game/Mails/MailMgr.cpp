@@ -19,12 +19,7 @@
 #include "CharacterCache.h"
 #include "Common.h"
 #include "DatabaseEnv.h"
-#include "GameTime.h"
-#include "Log.h"
 #include "Mail.h"
-#include "ObjectAccessor.h"
-#include "Timer.h"
-#include <map>
 
 MailMgr* MailMgr::instance()
 {
@@ -79,131 +74,67 @@ void MailMgr::DeleteEmptyExpiredMail(uint32 mailId, ObjectGuid::LowType receiver
     OnMailDeleted(receiverLow);
 }
 
-void MailMgr::ReturnOrDeleteOldMails(bool serverUp)
+bool MailMgr::ReturnOrDeleteExpiredMail(Mail& mail, time_t curTime)
 {
-    uint32 oldMSTime = getMSTime();
+    // Keep each mail's correlated writes atomic
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    CharacterDatabasePreparedStatement* stmt = nullptr;
 
-    time_t curTime = GameTime::GetGameTime().count();
-
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL);
-    stmt->SetData(0, uint32(curTime));
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-    if (!result)
-        return;
-
-    std::map<uint32 /*messageId*/, MailItemInfoVec> itemsCache;
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS);
-    stmt->SetData(0, uint32(curTime));
-    if (PreparedQueryResult items = CharacterDatabase.Query(stmt))
+    // Delete or return mail
+    if (!mail.items.empty())
     {
-        MailItemInfo item;
-        do
+        // If it is mail from non-player, or if it's already return mail, it shouldn't be returned, but deleted
+        if (!mail.IsSentByPlayer() || mail.IsSentByGM() || (mail.IsCODPayment() || mail.IsReturnedMail()))
         {
-            Field* fields = items->Fetch();
-            item.item_guid = fields[0].Get<uint32>();
-            item.item_template = fields[1].Get<uint32>();
-            uint32 mailId = fields[2].Get<uint32>();
-            itemsCache[mailId].push_back(item);
-        } while (items->NextRow());
-    }
+            for (auto const& mailedItem : mail.items)
+            {
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ITEM_INSTANCE);
+                stmt->SetData(0, mailedItem.item_guid);
+                trans->Append(stmt);
+            }
 
-    uint32 deletedCount = 0;
-    uint32 returnedCount = 0;
-    do
-    {
-        Field* fields = result->Fetch();
-        Mail* m = new Mail;
-        m->messageID      = fields[0].Get<uint32>();
-        m->messageType    = fields[1].Get<uint8>();
-        m->sender         = fields[2].Get<uint32>();
-        m->receiver       = fields[3].Get<uint32>();
-        bool has_items    = fields[4].Get<bool>();
-        m->expire_time    = time_t(fields[5].Get<uint32>());
-        m->deliver_time   = time_t(0);
-        m->stationery     = fields[6].Get<uint8>();
-        m->checked        = fields[7].Get<uint8>();
-        m->mailTemplateId = fields[8].Get<int16>();
-
-        Player* player = nullptr;
-        if (serverUp)
-            player = ObjectAccessor::FindPlayerByLowGUID(m->receiver);
-
-        if (player) // don't modify mails of a logged in player
-        {
-            delete m;
-            continue;
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_ITEM_BY_ID);
+            stmt->SetData(0, mail.messageID);
+            trans->Append(stmt);
         }
-
-        // Keep each mail's correlated writes atomic
-        CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
-
-        // Delete or return mail
-        if (has_items)
+        else
         {
-            // read items from cache
-            m->items.swap(itemsCache[m->messageID]);
-
-            // If it is mail from non-player, or if it's already return mail, it shouldn't be returned, but deleted
-            if (!m->IsSentByPlayer() || m->IsSentByGM() || (m->IsCODPayment() || m->IsReturnedMail()))
+            // Mail will be returned
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_RETURNED);
+            stmt->SetData(0, mail.receiver);
+            stmt->SetData(1, mail.sender);
+            stmt->SetData(2, uint32(curTime + 30 * DAY));
+            stmt->SetData(3, uint32(curTime));
+            stmt->SetData(4, uint8(MAIL_CHECK_MASK_RETURNED));
+            stmt->SetData(5, mail.messageID);
+            trans->Append(stmt);
+            for (auto const& mailedItem : mail.items)
             {
-                for (auto const& mailedItem : m->items)
-                {
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ITEM_INSTANCE);
-                    stmt->SetData(0, mailedItem.item_guid);
-                    trans->Append(stmt);
-                }
-
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_ITEM_BY_ID);
-                stmt->SetData(0, m->messageID);
+                // Update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_ITEM_RECEIVER);
+                stmt->SetData(0, mail.sender);
+                stmt->SetData(1, mailedItem.item_guid);
                 trans->Append(stmt);
-            }
-            else
-            {
-                // Mail will be returned
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_RETURNED);
-                stmt->SetData(0, m->receiver);
-                stmt->SetData(1, m->sender);
-                stmt->SetData(2, uint32(curTime + 30 * DAY));
-                stmt->SetData(3, uint32(curTime));
-                stmt->SetData(4, uint8(MAIL_CHECK_MASK_RETURNED));
-                stmt->SetData(5, m->messageID);
+
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ITEM_OWNER);
+                stmt->SetData(0, mail.sender);
+                stmt->SetData(1, mailedItem.item_guid);
                 trans->Append(stmt);
-                for (auto const& mailedItem : m->items)
-                {
-                    // Update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_ITEM_RECEIVER);
-                    stmt->SetData(0, m->sender);
-                    stmt->SetData(1, mailedItem.item_guid);
-                    trans->Append(stmt);
-
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ITEM_OWNER);
-                    stmt->SetData(0, m->sender);
-                    stmt->SetData(1, mailedItem.item_guid);
-                    trans->Append(stmt);
-                }
-
-                CharacterDatabase.CommitTransaction(trans);
-
-                OnMailReturned(m->receiver, m->sender);
-
-                delete m;
-                ++returnedCount;
-                continue;
             }
-        }
 
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
-        stmt->SetData(0, m->messageID);
-        trans->Append(stmt);
+            CharacterDatabase.CommitTransaction(trans);
 
-        CharacterDatabase.CommitTransaction(trans);
+            OnMailReturned(mail.receiver, mail.sender);
+            return true;
+        }
+    }
 
-        OnMailDeleted(m->receiver);
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
+    stmt->SetData(0, mail.messageID);
+    trans->Append(stmt);
 
-        delete m;
-        ++deletedCount;
-    } while (result->NextRow());
+    CharacterDatabase.CommitTransaction(trans);
 
-    LOG_INFO("server.loading", ">> Processed {} expired mails: {} deleted and {} returned in {} ms", deletedCount + returnedCount, deletedCount, returnedCount, GetMSTimeDiffToNow(oldMSTime));
-    LOG_INFO("server.loading", " ");
+    OnMailDeleted(mail.receiver);
+    return false;
 }
@@ -21,6 +21,8 @@
 #include "Define.h"
 #include "ObjectGuid.h"
 
+struct Mail;
+
 /**
  * @brief Owns the mail lifecycle bookkeeping that lives outside a single player
  * session: the per-character mail count mirrored in CharacterCache and the
@@ -69,17 +71,20 @@ public:
     /**
      * @brief Deletes an expired mail row that has no items, money or COD
      * attached. Used at login for mail that would otherwise stay invisible in
-     * the DB until ReturnOrDeleteOldMails catches the receiver offline.
+     * the DB until the expired mail job catches the receiver offline.
      * @param mailId Id of the mail row to delete
      * @param receiverLow Low GUID of the mail receiver
      */
     void DeleteEmptyExpiredMail(uint32 mailId, ObjectGuid::LowType receiverLow);
 
     /**
-     * @brief Returns expired mail with items to the sender and deletes the rest.
-     * @param serverUp When true, receivers that are currently online are skipped.
+     * @brief Returns an expired mail with items to its sender or deletes it.
+     * Driven by the expired mail maintenance job, the receiver must be offline.
+     * @param mail Expired mail with its items filled in
+     * @param curTime Time the expiry run started at
+     * @return true when the mail was returned, false when it was deleted
      */
-    void ReturnOrDeleteOldMails(bool serverUp);
+    bool ReturnOrDeleteExpiredMail(Mail& mail, time_t curTime);
 };
 
 #define sMailMgr MailMgr::instance()
@@ -0,0 +1,52 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LineOfSightCache.h"
+#include <cmath>
+
+namespace
+{
+    inline int32 Quantize(float value)
+    {
+        return int32(std::lround(value * LineOfSightCache::Precision));
+    }
+
+    inline void HashCombine(std::size_t& seed, uint64 value)
+    {
+        seed ^= std::size_t(value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+    }
+}
+
+LineOfSightCache::Key LineOfSightCache::MakeKey(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phaseMask, uint8 checks, uint32 ignoreFlags)
+{
+    Key key;
+    key.Ends = { Quantize(x1), Quantize(y1), Quantize(z1), Quantize(x2), Quantize(y2), Quantize(z2) };
+    key.PhaseMask = phaseMask;
+    key.IgnoreFlags = ignoreFlags;
+    key.Checks = checks;
+    return key;
+}
+
+std::size_t LineOfSightCache::KeyHash::operator()(Key const& key) const
+{
+    std::size_t seed = 0;
+    for (std::size_t i = 0; i < key.Ends.size(); i += 2)
+        HashCombine(seed, (uint64(uint32(key.Ends[i])) << 32) | uint32(key.Ends[i + 1]));
+
+    HashCombine(seed, (uint64(key.PhaseMask) << 32) | (key.IgnoreFlags << 8) | key.Checks);
+    return seed;
+}
@@ -0,0 +1,118 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AZEROTHCORE_LINEOFSIGHTCACHE_H
+#define AZEROTHCORE_LINEOFSIGHTCACHE_H
+
+#include "Define.h"
+#include <array>
+#include <unordered_map>
+
+/**
+ * Per map memo of line of sight results, keyed by both endpoints quantized to
+ * 1/8 yard plus phase mask, requested checks and model ignore flags.
+ *
+ * Entries live for one map update. Results that depend on the dynamic
+ * (gameobject) tree are also tagged with its generation, so doors opening and
+ * transports moving mid tick only force the dynamic part to be raycast again.
+ */
+class LineOfSightCache
+{
+public:
+    static constexpr float Precision = 8.0f;
+    static constexpr std::size_t MaxEntries = 16384;
+
+    struct Key
+    {
+        std::array<int32, 6> Ends;
+        uint32 PhaseMask;
+        uint32 IgnoreFlags;
+        uint8 Checks;
+
+        bool operator==(Key const& right) const = default;
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    static Key MakeKey(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phaseMask, uint8 checks, uint32 ignoreFlags);
+
+    /**
+     * Returns the cached result, or runs staticCheck / dynamicCheck (each returning
+     * true when the line is clear) for the parts that are missing or outdated.
+     */
+    template<class StaticCheck, class DynamicCheck>
+    bool IsInLineOfSight(Key const& key, bool checkStatic, bool checkDynamic, StaticCheck&& staticCheck, DynamicCheck&& dynamicCheck)
+    {
+        auto itr = _entries.find(key);
+        if (itr != _entries.end())
+        {
+            Entry& entry = itr->second;
+            if (entry.StaticBlocked || !checkDynamic || entry.Generation == _dynamicGeneration)
+            {
+                ++_hits;
+                return entry.Result;
+            }
+
+            // static part is known to be clear, only the gameobjects changed
+            ++_misses;
+            entry.Result = dynamicCheck();
+            entry.Generation = _dynamicGeneration;
+            return entry.Result;
+        }
+
+        ++_misses;
+
+        Entry entry;
+        entry.StaticBlocked = checkStatic && !staticCheck();
+        entry.Result = !entry.StaticBlocked && (!checkDynamic || dynamicCheck());
+        entry.Generation = _dynamicGeneration;
+
+        if (_entries.size() >= MaxEntries)
+            _entries.clear();
+
+        _entries.emplace(key, entry);
+        return entry.Result;
+    }
+
+    /// Called once per map update, nothing cached may survive into the next tick
+    void Clear() { _entries.clear(); }
+
+    /// Gameobject collision was added, removed, moved or toggled
+    void InvalidateDynamic() { ++_dynamicGeneration; }
+
+    [[nodiscard]] uint32 GetHits() const { return _hits; }
+    [[nodiscard]] uint32 GetMisses() const { return _misses; }
+    void ResetStats() { _hits = 0; _misses = 0; }
+
+private:
+    struct Entry
+    {
+        bool StaticBlocked;
+        bool Result;
+        uint32 Generation;
+    };
+
+    std::unordered_map<Key, Entry, KeyHash> _entries;
+    uint32 _dynamicGeneration = 0;
+    uint32 _hits = 0;
+    uint32 _misses = 0;
+};
+
+#endif // AZEROTHCORE_LINEOFSIGHTCACHE_H
@@ -21,6 +21,7 @@
 #include "Chat.h"
 #include "DisableMgr.h"
 #include "DynamicTree.h"
+#include "FrameArena.h"
 #include "GameTime.h"
 #include "Geometry.h"
 #include "GridNotifiers.h"
@@ -435,6 +436,10 @@ void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 
 void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 {
+    // Temporaries of the previous tick on this thread are gone by now
+    Acore::FrameArena::Instance().Reset();
+    _lineOfSightCache.Clear();
+
     if (t_diff)
         _mapCollisionData.GetDynamicTree().update(t_diff);
 
@@ -463,6 +468,8 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         return;
     }
 
+    uint32 const updateStartTime = getMSTime();
+
     /// Process any due respawns (non-compatibility mode spawns)
     if (!sWorld->getBoolConfig(CONFIG_RESPAWN_FORCE_COMPATIBILITY_MODE))
     {
@@ -475,6 +482,14 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
             _respawnCheckTimer -= t_diff;
     }
 
+    if (_respawnSaveTimer <= t_diff)
+    {
+        SaveRespawnTimesToDB();
+        _respawnSaveTimer = sWorld->getIntConfig(CONFIG_RESPAWN_SAVE_INTERVAL);
+    }
+    else
+        _respawnSaveTimer -= t_diff;
+
     _updatableObjectListRecheckTimer.Update(t_diff);
     resetMarkedCells();
 
@@ -505,7 +520,7 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 
     UpdateNonPlayerObjects(t_diff);
 
-    SendObjectUpdates();
+    SendObjectUpdates(t_diff);
 
     ///- Process necessary scripts
     if (!m_scriptSchedule.empty())
@@ -528,6 +543,8 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 
     sScriptMgr->OnMapUpdate(this, t_diff);
 
+    UpdateDynamicVisibility(t_diff, GetMSTimeDiffToNow(updateStartTime));
+
     METRIC_VALUE("map_creatures", uint64(GetObjectsStore().Size<Creature>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
@@ -535,6 +552,81 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_los_cache_hits", uint64(_lineOfSightCache.GetHits()),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_los_cache_misses", uint64(_lineOfSightCache.GetMisses()),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    _lineOfSightCache.ResetStats();
+}
+
+void Map::UpdateDynamicVisibility(uint32 diff, uint32 updateTime)
+{
+    _dynamicVisibility.avgUpdateTime = (_dynamicVisibility.avgUpdateTime * 7 + updateTime) / 8;
+
+    _dynamicVisibility.evaluateTimer += diff;
+    if (_dynamicVisibility.evaluateTimer < DYNAMIC_VISIBILITY_EVALUATE_INTERVAL)
+        return;
+
+    uint32 const elapsed = _dynamicVisibility.evaluateTimer;
+    _dynamicVisibility.evaluateTimer = 0;
+
+    uint8 level = DynamicVisibilityMgr::SelectLevel(_dynamicVisibility, elapsed, GetDensestCellPlayerCount());
+    if (level != _dynamicVisibility.level)
+    {
+        LOG_DEBUG("maps", "Map {} instance {}: dynamic visibility level {} -> {} (average update time {} ms)",
+            GetId(), GetInstanceId(), _dynamicVisibility.level, level, _dynamicVisibility.avgUpdateTime);
+
+        _dynamicVisibility.level = level;
+    }
+
+    // Also picks up a changed range of the current level after a config reload
+    _visibilityRangeFactor = DynamicVisibilityMgr::GetSettings(level).visibilityRangeFactor;
+
+    METRIC_VALUE("map_visibility_level", uint64(level),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+}
+
+uint32 Map::GetDensestCellPlayerCount() const
+{
+    if (m_mapRefMgr.getSize() <= 1)
+        return m_mapRefMgr.getSize();
+
+    std::unordered_map<uint32 /*cellId*/, uint32> cellPlayers;
+    for (MapRefMgr::const_iterator itr = m_mapRefMgr.begin(); itr != m_mapRefMgr.end(); ++itr)
+        if (Player const* player = itr->GetSource())
+            if (player->IsInWorld())
+                ++cellPlayers[Acore::ComputeCellCoord(player->GetPositionX(), player->GetPositionY()).normalize().GetId()];
+
+    // Players around a cell, the 3x3 block roughly covers what a player in its middle can see
+    uint32 densest = 0;
+    for (auto const& [cellId, count] : cellPlayers)
+    {
+        CellCoord center(cellId % TOTAL_NUMBER_OF_CELLS_PER_MAP, cellId / TOTAL_NUMBER_OF_CELLS_PER_MAP);
+        uint32 players = 0;
+        for (int32 dx = -1; dx <= 1; ++dx)
+        {
+            for (int32 dy = -1; dy <= 1; ++dy)
+            {
+                CellCoord neighbour(center.x_coord + dx, center.y_coord + dy);
+                if (!neighbour.IsCoordValid())
+                    continue;
+
+                auto itr = cellPlayers.find(neighbour.GetId());
+                if (itr != cellPlayers.end())
+                    players += itr->second;
+            }
+        }
+
+        densest = std::max(densest, players);
+    }
+
+    return densest;
 }
 
 void Map::UpdateNonPlayerObjects(uint32 const diff)
@@ -1090,6 +1182,9 @@ void Map::UnloadAll()
     _corpsesByGrid.clear();
     _corpsesByPlayer.clear();
     _corpseBones.clear();
+
+    // Objects removed above may have queued respawn times as well
+    SaveRespawnTimesToDB();
 }
 
 std::shared_ptr<GridTerrainData> Map::GetGridTerrainDataSharedPtr(GridCoord const& gridCoord)
@@ -1560,26 +1655,32 @@ bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, floa
         }
     }
 
-    if ((checks & LINEOFSIGHT_CHECK_VMAP) && !_mapCollisionData.GetStaticTree().isInLineOfSight(x1, y1, z1, x2, y2, z2, ignoreFlags))
+    bool const checkStatic = checks & LINEOFSIGHT_CHECK_VMAP;
+    bool const checkDynamic = sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT_ALL);
+
+    auto staticCheck = [&]()
     {
-        return false;
-    }
+        return _mapCollisionData.GetStaticTree().isInLineOfSight(x1, y1, z1, x2, y2, z2, ignoreFlags);
+    };
 
-    if (sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT_ALL))
+    auto dynamicCheck = [&]()
     {
-        ignoreFlags = VMAP::ModelIgnoreFlags::Nothing;
+        VMAP::ModelIgnoreFlags dynamicIgnoreFlags = VMAP::ModelIgnoreFlags::Nothing;
         if (!(checks & LINEOFSIGHT_CHECK_GOBJECT_M2))
         {
-            ignoreFlags = VMAP::ModelIgnoreFlags::M2;
+            dynamicIgnoreFlags = VMAP::ModelIgnoreFlags::M2;
         }
 
-        if (!_mapCollisionData.GetDynamicTree().isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask, ignoreFlags))
-        {
-            return false;
-        }
+        return _mapCollisionData.GetDynamicTree().isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask, dynamicIgnoreFlags);
+    };
+
+    if (!sWorld->getBoolConfig(CONFIG_VMAP_LOS_CACHE))
+    {
+        return (!checkStatic || staticCheck()) && (!checkDynamic || dynamicCheck());
     }
 
-    return true;
+    LineOfSightCache::Key key = LineOfSightCache::MakeKey(x1, y1, z1, x2, y2, z2, phasemask, uint8(checks), uint32(ignoreFlags));
+    return _lineOfSightCache.IsInLineOfSight(key, checkStatic, checkDynamic, staticCheck, dynamicCheck);
 }
 
 float Map::GetHeight(uint32 phasemask, float x, float y, float z, bool vmap/*=true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/) const
@@ -1705,7 +1806,7 @@ void Map::SendRemoveTransports(Player* player)
     player->SendDirectMessage(&packet);
 }
 
-void Map::SendObjectUpdates()
+void Map::SendObjectUpdates(uint32 diff)
 {
     UpdateDataMapType update_players;
 
@@ -1718,6 +1819,16 @@ void Map::SendObjectUpdates()
         obj->BuildUpdate(update_players);
     }
 
+    _deferredUpdateTimer = _deferredUpdateTimer > diff ? _deferredUpdateTimer - diff : 0;
+    if (!_deferredUpdateTimer && !_deferredUpdateObjects.empty())
+    {
+        for (WorldObject* obj : _deferredUpdateObjects)
+            obj->BuildDeferredUpdate(update_players);
+
+        _deferredUpdateObjects.clear();
+        _deferredUpdateTimer = sWorld->getIntConfig(CONFIG_INTEREST_FAR_UPDATE_INTERVAL);
+    }
+
     WorldPacket packet;                                     // here we allocate a std::vector with a size of 0x10000
     for (UpdateDataMapType::iterator iter = update_players.begin(); iter != update_players.end(); ++iter)
     {
@@ -2467,12 +2578,11 @@ void Map::SaveCreatureRespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTi
     _creatureRespawnTimes[spawnId] = respawnTime;
     _respawnQueue.insert({respawnTime, SPAWN_TYPE_CREATURE, spawnId});
 
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CREATURE_RESPAWN);
-    stmt->SetData(0, spawnId);
-    stmt->SetData(1, uint32(respawnTime));
-    stmt->SetData(2, GetId());
-    stmt->SetData(3, GetInstanceId());
-    CharacterDatabase.Execute(stmt);
+    _pendingCreatureRespawnSaves[spawnId] = respawnTime;
+    ++_pendingRespawnSaveChanges;
+
+    if (!sWorld->getIntConfig(CONFIG_RESPAWN_SAVE_INTERVAL))
+        SaveRespawnTimesToDB();
 }
 
 void Map::RemoveCreatureRespawnTime(ObjectGuid::LowType spawnId)
@@ -2484,11 +2594,11 @@ void Map::RemoveCreatureRespawnTime(ObjectGuid::LowType spawnId)
         _creatureRespawnTimes.erase(itr);
     }
 
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN);
-    stmt->SetData(0, spawnId);
-    stmt->SetData(1, GetId());
-    stmt->SetData(2, GetInstanceId());
-    CharacterDatabase.Execute(stmt);
+    _pendingCreatureRespawnSaves[spawnId] = 0;
+    ++_pendingRespawnSaveChanges;
+
+    if (!sWorld->getIntConfig(CONFIG_RESPAWN_SAVE_INTERVAL))
+        SaveRespawnTimesToDB();
 }
 
 void Map::SaveGORespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
@@ -2512,12 +2622,11 @@ void Map::SaveGORespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
     _goRespawnTimes[spawnId] = respawnTime;
     _respawnQueue.insert({respawnTime, SPAWN_TYPE_GAMEOBJECT, spawnId});
 
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_GO_RESPAWN);
-    stmt->SetData(0, spawnId);
-    stmt->SetData(1, uint32(respawnTime));
-    stmt->SetData(2, GetId());
-    stmt->SetData(3, GetInstanceId());
-    CharacterDatabase.Execute(stmt);
+    _pendingGORespawnSaves[spawnId] = respawnTime;
+    ++_pendingRespawnSaveChanges;
+
+    if (!sWorld->getIntConfig(CONFIG_RESPAWN_SAVE_INTERVAL))
+        SaveRespawnTimesToDB();
 }
 
 void Map::RemoveGORespawnTime(ObjectGuid::LowType spawnId)
@@ -2529,11 +2638,11 @@ void Map::RemoveGORespawnTime(ObjectGuid::LowType spawnId)
         _goRespawnTimes.erase(itr);
     }
 
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GO_RESPAWN);
-    stmt->SetData(0, spawnId);
-    stmt->SetData(1, GetId());
-    stmt->SetData(2, GetInstanceId());
-    CharacterDatabase.Execute(stmt);
+    _pendingGORespawnSaves[spawnId] = 0;
+    ++_pendingRespawnSaveChanges;
+
+    if (!sWorld->getIntConfig(CONFIG_RESPAWN_SAVE_INTERVAL))
+        SaveRespawnTimesToDB();
 }
 
 void Map::LoadRespawnTimes()
@@ -2577,9 +2686,91 @@ void Map::DeleteRespawnTimes()
     _goRespawnTimes.clear();
     _respawnQueue.clear();
 
+    // Covered by the instance wide delete below
+    _pendingCreatureRespawnSaves.clear();
+    _pendingGORespawnSaves.clear();
+    _pendingRespawnSaveChanges = 0;
+
     DeleteRespawnTimesInDB(GetId(), GetInstanceId());
 }
 
+/// Appends the pending changes of one respawn table as multi-row REPLACE and DELETE statements, returns the number of statements
+static uint32 AppendRespawnTimeSaves(CharacterDatabaseTransaction trans, std::string_view table, std::unordered_map<ObjectGuid::LowType, time_t>& pending, uint32 mapId, uint32 instanceId)
+{
+    // Keeps single statements well below max_allowed_packet
+    constexpr std::size_t MAX_ROWS_PER_STATEMENT = 500;
+
+    uint32 statements = 0;
+    std::string replaceRows;
+    std::string deleteGuids;
+    std::size_t replaceCount = 0;
+    std::size_t deleteCount = 0;
+
+    auto flushReplace = [&]()
+    {
+        trans->Append("REPLACE INTO {} (guid, respawnTime, mapId, instanceId) VALUES {}", table, replaceRows);
+        replaceRows.clear();
+        replaceCount = 0;
+        ++statements;
+    };
+
+    auto flushDelete = [&]()
+    {
+        trans->Append("DELETE FROM {} WHERE mapId = {} AND instanceId = {} AND guid IN ({})", table, mapId, instanceId, deleteGuids);
+        deleteGuids.clear();
+        deleteCount = 0;
+        ++statements;
+    };
+
+    for (auto const& [spawnId, respawnTime] : pending)
+    {
+        if (respawnTime)
+        {
+            if (replaceCount++)
+                replaceRows += ',';
+
+            replaceRows += Acore::StringFormat("({},{},{},{})", spawnId, uint32(respawnTime), mapId, instanceId);
+            if (replaceCount == MAX_ROWS_PER_STATEMENT)
+                flushReplace();
+        }
+        else
+        {
+            if (deleteCount++)
+                deleteGuids += ',';
+
+            deleteGuids += std::to_string(spawnId);
+            if (deleteCount == MAX_ROWS_PER_STATEMENT)
+                flushDelete();
+        }
+    }
+
+    if (replaceCount)
+        flushReplace();
+
+    if (deleteCount)
+        flushDelete();
+
+    pending.clear();
+    return statements;
+}
+
+void Map::SaveRespawnTimesToDB()
+{
+    if (_pendingCreatureRespawnSaves.empty() && _pendingGORespawnSaves.empty())
+        return;
+
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    uint32 statements = AppendRespawnTimeSaves(trans, "creature_respawn", _pendingCreatureRespawnSaves, GetId(), GetInstanceId());
+    statements += AppendRespawnTimeSaves(trans, "gameobject_respawn", _pendingGORespawnSaves, GetId(), GetInstanceId());
+    CharacterDatabase.CommitTransaction(trans);
+
+    METRIC_VALUE("map_respawn_time_changes", _pendingRespawnSaveChanges, METRIC_TAG("map_id", std::to_string(GetId())));
+    METRIC_VALUE("map_respawn_time_statements", statements, METRIC_TAG("map_id", std::to_string(GetId())));
+
+    LOG_DEBUG("maps", "Map {} instance {}: wrote {} respawn time changes with {} statements", GetId(), GetInstanceId(), _pendingRespawnSaveChanges, statements);
+    _pendingRespawnSaveChanges = 0;
+}
+
 void Map::DeleteRespawnTimesInDB(uint16 mapId, uint32 instanceId)
 {
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN_BY_INSTANCE);
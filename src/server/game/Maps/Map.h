@@ -23,11 +23,13 @@
 #include "DataMap.h"
 #include "Define.h"
 #include "DynamicTree.h"
+#include "DynamicVisibility.h"
 #include "EventProcessor.h"
 #include "GameObjectModel.h"
 #include "GridDefines.h"
 #include "GridRefMgr.h"
 #include "Timer.h"
+#include "LineOfSightCache.h"
 #include "MapCollisionData.h"
 #include "MapGridManager.h"
 #include "MapRefMgr.h"
@@ -197,8 +199,9 @@ public:
 
     virtual void Update(const uint32, const uint32, bool thread = true);
 
-    [[nodiscard]] float GetVisibilityRange() const { return m_VisibleDistance; }
+    [[nodiscard]] float GetVisibilityRange() const { return m_VisibleDistance * _visibilityRangeFactor; }
     void SetVisibilityRange(float range) { m_VisibleDistance = range; }
+    [[nodiscard]] uint8 GetDynamicVisibilityLevel() const { return _dynamicVisibility.level; }
     void OnCreateMap();
     //function for setting up visibility distance for maps on per-type/per-Id basis
     virtual void InitVisibilityDistance();
@@ -401,8 +404,10 @@ public:
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CheckCollisionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true) const;
     void Balance() { _mapCollisionData.GetDynamicTree().balance(); }
-    void RemoveGameObjectModel(GameObjectModel const& model) { _mapCollisionData.GetDynamicTree().remove(model); }
-    void InsertGameObjectModel(GameObjectModel const& model) { _mapCollisionData.GetDynamicTree().insert(model); }
+    void RemoveGameObjectModel(GameObjectModel const& model) { _mapCollisionData.GetDynamicTree().remove(model); _lineOfSightCache.InvalidateDynamic(); }
+    void InsertGameObjectModel(GameObjectModel const& model) { _mapCollisionData.GetDynamicTree().insert(model); _lineOfSightCache.InvalidateDynamic(); }
+    /// Gameobject collision was toggled without leaving the dynamic tree (doors and similar)
+    void OnGameObjectCollisionChanged() { _lineOfSightCache.InvalidateDynamic(); }
     [[nodiscard]] bool ContainsGameObjectModel(GameObjectModel const& model) const { return _mapCollisionData.GetDynamicTree().contains(model);}
     [[nodiscard]] DynamicMapTree const& GetDynamicMapTree() const { return _mapCollisionData.GetDynamicTree(); }
     [[nodiscard]] float GetGameObjectFloor(uint32 phasemask, float x, float y, float z, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const
@@ -439,6 +444,11 @@ public:
     [[nodiscard]] std::unordered_map<ObjectGuid::LowType, time_t> const& GetGORespawnTimes() const { return _goRespawnTimes; }
     void LoadRespawnTimes();
     void DeleteRespawnTimes();
+    void SaveRespawnTimesToDB();
+
+    void UpdateDynamicVisibility(uint32 diff, uint32 updateTime);
+    [[nodiscard]] uint32 GetDensestCellPlayerCount() const;
+
     [[nodiscard]] time_t GetInstanceResetPeriod() const { return _instanceResetPeriod; }
 
     void UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone);
@@ -541,6 +551,9 @@ public:
         _updateObjects.erase(obj);
     }
 
+    void AddDeferredUpdateObject(WorldObject* obj) { _deferredUpdateObjects.insert(obj); }
+    void RemoveDeferredUpdateObject(WorldObject* obj) { _deferredUpdateObjects.erase(obj); }
+
     size_t GetUpdatableObjectsCount() const { return _updatableObjectList.size(); }
 
     virtual std::string GetDebugInfo() const;
@@ -592,7 +605,7 @@ private:
 
     void ScriptsProcess();
 
-    void SendObjectUpdates();
+    void SendObjectUpdates(uint32 diff);
 
     void UpdatePlayersRedirectKickEvent(uint32 diff);
 
@@ -606,10 +619,12 @@ protected:
     MapGridManager _mapGridManager;
     MapEntry const* i_mapEntry;
     MapCollisionData _mapCollisionData;
+    mutable LineOfSightCache _lineOfSightCache;
     uint8 i_spawnMode;
     uint32 i_InstanceId;
     uint32 m_unloadTimer;
     float m_VisibleDistance;
+    float _visibilityRangeFactor{1.0f}; // lowered by dynamic visibility on crowded maps
     time_t _instanceResetPeriod; // pussywizard
 
     MapRefMgr m_mapRefMgr;
@@ -651,6 +666,15 @@ private:
     std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t> _creatureRespawnTimes;
     std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t> _goRespawnTimes;
 
+    // Respawn time changes not yet written to the character DB, a respawn time of 0 marks a delete.
+    // Flushed by SaveRespawnTimesToDB() every Respawn.SaveInterval and on unload.
+    std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t> _pendingCreatureRespawnSaves;
+    std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t> _pendingGORespawnSaves;
+    uint32 _pendingRespawnSaveChanges{0};
+    uint32 _respawnSaveTimer{0};
+
+    DynamicVisibilityState _dynamicVisibility;
+
     // Time-ordered index for ProcessRespawns() — avoids O(n) full scan.
     // Based on TrinityCore's priority queue approach (r00ty-tc, 59db2eee).
     struct RespawnEntry
@@ -701,6 +725,9 @@ private:
     std::unordered_set<Corpse*> _corpseBones;
 
     std::unordered_set<Object*> _updateObjects;
+    // Objects with value changes coalesced for far observers, see InterestTier
+    std::unordered_set<WorldObject*> _deferredUpdateObjects;
+    uint32 _deferredUpdateTimer{0};
 
     UpdatableObjectList _updatableObjectList;
     PendingAddUpdatableObjectList _pendingAddUpdatableObjectList;
@@ -0,0 +1,121 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SpawnSpatialIndex.h"
+#include "GridDefines.h"
+#include <algorithm>
+
+uint64 SpawnSpatialIndex::MakeBucketKey(uint32 mapId, float x, float y)
+{
+    CellCoord cell = Acore::ComputeCellCoord(x, y).normalize();
+    return (uint64(mapId) << 32) | cell.GetId();
+}
+
+void SpawnSpatialIndex::Insert(SpawnData const* data)
+{
+    uint64 key = MakeBucketKey(data->mapid, data->posX, data->posY);
+
+    auto [itr, inserted] = _locations.try_emplace(data, key);
+    if (!inserted)
+    {
+        if (itr->second == key)
+            return;
+
+        RemoveFromBucket(itr->second, data);
+        itr->second = key;
+    }
+
+    _buckets[key].push_back(data);
+}
+
+void SpawnSpatialIndex::Remove(SpawnData const* data)
+{
+    auto itr = _locations.find(data);
+    if (itr == _locations.end())
+        return;
+
+    RemoveFromBucket(itr->second, data);
+    _locations.erase(itr);
+}
+
+void SpawnSpatialIndex::RemoveFromBucket(uint64 key, SpawnData const* data)
+{
+    auto bucket = _buckets.find(key);
+    if (bucket == _buckets.end())
+        return;
+
+    SpawnList& spawns = bucket->second;
+    auto itr = std::find(spawns.begin(), spawns.end(), data);
+    if (itr != spawns.end())
+    {
+        *itr = spawns.back();
+        spawns.pop_back();
+    }
+
+    if (spawns.empty())
+        _buckets.erase(bucket);
+}
+
+void SpawnSpatialIndex::GetSpawnsInBox(SpawnList& result, uint32 mapId, float minX, float minY, float maxX, float maxY, uint8 typeMask) const
+{
+    if (_buckets.empty())
+        return;
+
+    // Cell coordinates grow towards negative world coordinates
+    CellCoord low = Acore::ComputeCellCoord(maxX, maxY).normalize();
+    CellCoord high = Acore::ComputeCellCoord(minX, minY).normalize();
+
+    uint64 const mapKey = uint64(mapId) << 32;
+    for (uint32 cellX = low.x_coord; cellX <= high.x_coord; ++cellX)
+    {
+        for (uint32 cellY = low.y_coord; cellY <= high.y_coord; ++cellY)
+        {
+            auto bucket = _buckets.find(mapKey | CellCoord(cellX, cellY).GetId());
+            if (bucket == _buckets.end())
+                continue;
+
+            for (SpawnData const* data : bucket->second)
+            {
+                if (!(typeMask & (1 << data->type)))
+                    continue;
+
+                if (data->posX < minX || data->posX > maxX || data->posY < minY || data->posY > maxY)
+                    continue;
+
+                result.push_back(data);
+            }
+        }
+    }
+}
+
+void SpawnSpatialIndex::GetSpawnsInRange(SpawnList& result, uint32 mapId, float x, float y, float z, float radius, uint8 typeMask) const
+{
+    std::size_t const first = result.size();
+    GetSpawnsInBox(result, mapId, x - radius, y - radius, x + radius, y + radius, typeMask);
+
+    auto distSq = [x, y, z](SpawnData const* data)
+    {
+        float dx = data->posX - x;
+        float dy = data->posY - y;
+        float dz = data->posZ - z;
+        return dx * dx + dy * dy + dz * dz;
+    };
+
+    float const radiusSq = radius * radius;
+    result.erase(std::remove_if(result.begin() + first, result.end(), [&](SpawnData const* data) { return distSq(data) > radiusSq; }), result.end());
+    std::sort(result.begin() + first, result.end(), [&](SpawnData const* a, SpawnData const* b) { return distSq(a) < distSq(b); });
+}
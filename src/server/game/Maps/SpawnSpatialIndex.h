@@ -0,0 +1,58 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AZEROTHCORE_SPAWNSPATIALINDEX_H
+#define AZEROTHCORE_SPAWNSPATIALINDEX_H
+
+#include "SpawnData.h"
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Uniform grid over the positions of all creature and gameobject spawns, bucketed
+ * per map and per cell (SIZE_OF_GRID_CELL yards), independent of spawn mode and
+ * game event state.
+ *
+ * Buckets hold pointers into ObjectMgr's spawn data stores, so every change of a
+ * spawn's map or position must be followed by Insert() and every erase preceded
+ * by Remove().
+ */
+class SpawnSpatialIndex
+{
+public:
+    typedef std::vector<SpawnData const*> SpawnList;
+
+    /// Adds the spawn, or moves it to its current cell if it is already indexed
+    void Insert(SpawnData const* data);
+    void Remove(SpawnData const* data);
+
+    /// Appends the spawns of the map within 3D radius of the point, sorted by distance
+    void GetSpawnsInRange(SpawnList& result, uint32 mapId, float x, float y, float z, float radius, uint8 typeMask = SPAWN_TYPEMASK_ALL) const;
+    /// Appends the spawns of the map inside the 2D box, in no particular order
+    void GetSpawnsInBox(SpawnList& result, uint32 mapId, float minX, float minY, float maxX, float maxY, uint8 typeMask = SPAWN_TYPEMASK_ALL) const;
+
+    [[nodiscard]] std::size_t GetSize() const { return _locations.size(); }
+
+private:
+    static uint64 MakeBucketKey(uint32 mapId, float x, float y);
+    void RemoveFromBucket(uint64 key, SpawnData const* data);
+
+    std::unordered_map<uint64 /*mapId << 32 | cellId*/, SpawnList> _buckets;
+    std::unordered_map<SpawnData const*, uint64> _locations;
+};
+
+#endif // AZEROTHCORE_SPAWNSPATIALINDEX_H
@@ -16,13 +16,104 @@
  */
 
 #include "DynamicVisibility.h"
+#include "Config.h"
+#include "Log.h"
+#include "Map.h"
+#include "StringConvert.h"
+#include "Tokenize.h"
+#include <algorithm>
 
-uint8 DynamicVisibilityMgr::visibilitySettingsIndex = 0;
+std::vector<VisibilitySettingData> DynamicVisibilityMgr::visibilitySettings = { { 0, 300, 150, 1.0f, 1.0f } };
+bool DynamicVisibilityMgr::enabled = true;
+uint32 DynamicVisibilityMgr::updateTimeThreshold = 0;
+uint32 DynamicVisibilityMgr::lowerDelay = 0;
 
-void DynamicVisibilityMgr::Update(uint32 sessionCount)
+void DynamicVisibilityMgr::LoadFromConfig()
 {
-    if (sessionCount >= (visibilitySettingsIndex + 1) * ((uint32)VISIBILITY_SETTINGS_PLAYER_INTERVAL) && visibilitySettingsIndex < VISIBILITY_SETTINGS_MAX_INTERVAL_NUM - 1)
-        ++visibilitySettingsIndex;
-    else if (visibilitySettingsIndex && sessionCount < visibilitySettingsIndex * ((uint32)VISIBILITY_SETTINGS_PLAYER_INTERVAL) - 100)
-        --visibilitySettingsIndex;
+    enabled = sConfigMgr->GetOption<bool>("Visibility.Dynamic.Enable", true);
+    updateTimeThreshold = sConfigMgr->GetOption<uint32>("Visibility.Dynamic.UpdateTimeThreshold", 150);
+    lowerDelay = sConfigMgr->GetOption<uint32>("Visibility.Dynamic.LowerDelay", 30000);
+
+    std::string levels = sConfigMgr->GetOption<std::string>("Visibility.Dynamic.Levels",
+        "0 300 150 1 100, 25 400 200 1.5 100, 50 500 250 2 100, 100 700 350 2.5 90, 200 1000 500 4 80, 300 1200 550 4.5 70");
+
+    std::vector<VisibilitySettingData> settings;
+    for (std::string_view level : Acore::Tokenize(levels, ',', false))
+    {
+        std::vector<std::string_view> fields = Acore::Tokenize(level, ' ', false);
+        if (fields.size() != 5)
+        {
+            LOG_ERROR("server.loading", "Visibility.Dynamic.Levels: level '{}' must have 5 fields, skipped.", level);
+            continue;
+        }
+
+        Optional<uint32> minPlayers = Acore::StringTo<uint32>(fields[0]);
+        Optional<uint32> notifyDelay = Acore::StringTo<uint32>(fields[1]);
+        Optional<uint32> aiNotifyDelay = Acore::StringTo<uint32>(fields[2]);
+        Optional<float> moveDistance = Acore::StringTo<float>(fields[3]);
+        Optional<uint32> rangePct = Acore::StringTo<uint32>(fields[4]);
+        if (!minPlayers || !notifyDelay || !aiNotifyDelay || !moveDistance || !rangePct)
+        {
+            LOG_ERROR("server.loading", "Visibility.Dynamic.Levels: level '{}' is not valid, skipped.", level);
+            continue;
+        }
+
+        // Do not shrink visibility below half of the configured distance, aggro radius depends on it
+        float rangeFactor = std::clamp<uint32>(*rangePct, 50, 100) / 100.0f;
+        settings.push_back({ *minPlayers, *notifyDelay, *aiNotifyDelay, *moveDistance * *moveDistance, rangeFactor });
+    }
+
+    if (settings.empty())
+    {
+        LOG_ERROR("server.loading", "Visibility.Dynamic.Levels has no valid level, using default visibility settings.");
+        settings.push_back({ 0, 300, 150, 1.0f, 1.0f });
+    }
+
+    std::stable_sort(settings.begin(), settings.end(), [](VisibilitySettingData const& a, VisibilitySettingData const& b) { return a.minPlayers < b.minPlayers; });
+    visibilitySettings = std::move(settings);
+}
+
+uint8 DynamicVisibilityMgr::SelectLevel(DynamicVisibilityState& state, uint32 elapsed, uint32 densestCellPlayers)
+{
+    if (!enabled)
+        return 0;
+
+    uint8 const maxLevel = uint8(std::min<std::size_t>(visibilitySettings.size(), 256) - 1);
+    uint8 target = 0;
+    for (uint8 i = 1; i <= maxLevel; ++i)
+        if (densestCellPlayers >= visibilitySettings[i].minPlayers)
+            target = i;
+
+    // A map that cannot keep up goes above whatever its population asks for
+    if (updateTimeThreshold && state.avgUpdateTime > updateTimeThreshold)
+        target = std::max<uint8>(target, std::min<uint8>(state.level + 1, maxLevel));
+
+    if (target >= state.level)
+    {
+        state.lowerTimer = 0;
+        return target;
+    }
+
+    // Step down one level at a time, and only once the map has been quiet for a while
+    state.lowerTimer += elapsed;
+    if (state.lowerTimer < lowerDelay)
+        return state.level;
+
+    state.lowerTimer = 0;
+    return state.level - 1;
+}
+
+uint32 DynamicVisibilityMgr::GetVisibilityNotifyDelay(Map const* map)
+{
+    return GetSettings(map->GetDynamicVisibilityLevel()).visibilityNotifyDelay;
+}
+
+uint32 DynamicVisibilityMgr::GetAINotifyDelay(Map const* map)
+{
+    return GetSettings(map->GetDynamicVisibilityLevel()).aiNotifyDelay;
+}
+
+float DynamicVisibilityMgr::GetReqMoveDistSq(Map const* map)
+{
+    return GetSettings(map->GetDynamicVisibilityLevel()).requiredMoveDistanceSq;
 }
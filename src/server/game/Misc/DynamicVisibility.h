@@ -19,40 +19,50 @@
 #define __DYNAMICVISIBILITY_H
 
 #include "Define.h"
+#include <vector>
+
+class Map;
+
+// How often a map re-evaluates its visibility level
+#define DYNAMIC_VISIBILITY_EVALUATE_INTERVAL 1000
 
 struct VisibilitySettingData
 {
+    uint32 minPlayers;                  // players around the densest cell of the map
     uint32 visibilityNotifyDelay;
     uint32 aiNotifyDelay;
     float requiredMoveDistanceSq;
+    float visibilityRangeFactor;        // applied to the map's configured visibility distance
 };
 
-// pussywizard: dynamic visibility settings
-// 7 player intervals: 0-499, 500-999, 1000-1499, 1500-1999, 2000-2499, 2500-2999, 3000+
-// 5 map types: common, instance, raid, bg, arena
-// feel free to add more intervals, change existing ones or move to conf file :P
-#define VISIBILITY_SETTINGS_PLAYER_INTERVAL 500
-#define VISIBILITY_SETTINGS_MAX_INTERVAL_NUM 7
-const VisibilitySettingData VisibilitySettings[VISIBILITY_SETTINGS_MAX_INTERVAL_NUM][5] =
+// Dynamic visibility state of a single map, owned by the map
+struct DynamicVisibilityState
 {
-    { {300, 150, 1.0f}, {300, 150, 1.0f}, {300, 150, 1.0f}, {300, 150, 1.0f}, {300, 150, 1.0f} }, // 0-499
-    { {400, 200, 2.25f}, {400, 200, 2.25f}, {400, 200, 2.25f}, {300, 150, 1.0f}, {300, 150, 1.0f} }, // 500-999
-    { {500, 250, 4.0f}, {500, 250, 4.0f}, {500, 250, 4.0f}, {400, 200, 2.25f}, {300, 150, 1.0f} }, // 1000-1499
-    { {700, 350, 6.25f}, {700, 350, 6.25f}, {700, 350, 6.25f}, {600, 300, 6.25f}, {300, 200, 1.0f} }, // 1500-1999
-    { {1000, 500, 16.0f}, {1000, 500, 16.0f}, {1000, 500, 16.0f}, {1000, 500, 16.0f}, {300, 250, 1.0f} }, // 2000-2499
-    { {1000, 500, 16.0f}, {1000, 500, 16.0f}, {1000, 500, 16.0f}, {1000, 500, 16.0f}, {300, 350, 1.0f} }, // 2500-2999
-    { {1200, 550, 20.0f}, {1200, 550, 25.0f}, {1200, 550, 25.0f}, {1100, 550, 16.0f}, {300, 350, 1.0f} } // 3000+
+    uint8 level = 0;
+    uint32 evaluateTimer = 0;
+    uint32 lowerTimer = 0;              // how long the map has been asking for a lower level
+    uint32 avgUpdateTime = 0;           // smoothed duration of full map updates
 };
 
+// pussywizard: dynamic visibility settings
+// Levels are picked per map from its local player density and update time, see Visibility.Dynamic.* in worldserver.conf
 class DynamicVisibilityMgr
 {
 public:
-    static void Update(uint32 sessionCount);
-    static uint32 GetVisibilityNotifyDelay(uint32 map_type) { return VisibilitySettings[visibilitySettingsIndex][map_type].visibilityNotifyDelay; }
-    static uint32 GetAINotifyDelay(uint32 map_type) { return VisibilitySettings[visibilitySettingsIndex][map_type].aiNotifyDelay; }
-    static float GetReqMoveDistSq(uint32 map_type) { return VisibilitySettings[visibilitySettingsIndex][map_type].requiredMoveDistanceSq; }
+    static void LoadFromConfig();
+
+    // Returns the level the map should use now, level changes go through hysteresis
+    static uint8 SelectLevel(DynamicVisibilityState& state, uint32 elapsed, uint32 densestCellPlayers);
+
+    static VisibilitySettingData const& GetSettings(uint8 level) { return visibilitySettings[level < visibilitySettings.size() ? level : visibilitySettings.size() - 1]; }
+    static uint32 GetVisibilityNotifyDelay(Map const* map);
+    static uint32 GetAINotifyDelay(Map const* map);
+    static float GetReqMoveDistSq(Map const* map);
 protected:
-    static uint8 visibilitySettingsIndex;
+    static std::vector<VisibilitySettingData> visibilitySettings;
+    static bool enabled;
+    static uint32 updateTimeThreshold;
+    static uint32 lowerDelay;
 };
 
 #endif
@@ -179,11 +179,7 @@ bool OPvPCapturePoint::DelCreature(uint32 type)
     //if (Map* map = sMapMgr->FindMap(cr->GetMapId()))
     //    map->Remove(cr, false);
     // delete respawn time for this creature
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN);
-    stmt->SetData(0, spawnId);
-    stmt->SetData(1, _pvp->GetMap()->GetId());
-    stmt->SetData(2, 0);  // instance id, always 0 for world maps
-    CharacterDatabase.Execute(stmt);
+    _pvp->GetMap()->RemoveCreatureRespawnTime(spawnId);
 
     sObjectMgr->DeleteCreatureData(spawnId);
     _creatureTypes[_creatures[type]] = 0;
@@ -54,9 +54,23 @@ bool ScriptMgr::OnItemRoll(Player const* player, LootStoreItem const* lootStoreI
     CALL_ENABLED_BOOLEAN_HOOKS(GlobalScript, GLOBALHOOK_ON_ITEM_ROLL, !script->OnItemRoll(player, lootStoreItem, chance, loot, store));
 }
 
-bool ScriptMgr::OnBeforeLootEqualChanced(Player const* player, LootStoreItemList equalChanced, Loot& loot, LootStore const& store)
+bool ScriptMgr::HasItemRollHooks() const
 {
-    CALL_ENABLED_BOOLEAN_HOOKS(GlobalScript, GLOBALHOOK_ON_BEFORE_LOOT_EQUAL_CHANCED, !script->OnBeforeLootEqualChanced(player, equalChanced, loot, store));
+    return !ScriptRegistry<GlobalScript>::EnabledHooks[GLOBALHOOK_ON_ITEM_ROLL].empty();
+}
+
+bool ScriptMgr::OnBeforeLootEqualChanced(Player const* player, LootStoreItemVector const& equalChanced, Loot& loot, LootStore const& store)
+{
+    if (ScriptRegistry<GlobalScript>::EnabledHooks[GLOBALHOOK_ON_BEFORE_LOOT_EQUAL_CHANCED].empty())
+        return true;
+
+    // Scripts still receive the entries as a list, only built when someone listens
+    LootStoreItemList const entries(equalChanced.begin(), equalChanced.end());
+    for (auto const& script : ScriptRegistry<GlobalScript>::EnabledHooks[GLOBALHOOK_ON_BEFORE_LOOT_EQUAL_CHANCED])
+        if (!script->OnBeforeLootEqualChanced(player, entries, loot, store))
+            return false;
+
+    return true;
 }
 
 void ScriptMgr::OnInitializeLockedDungeons(Player* player, uint8& level, uint32& lockData, lfg::LFGDungeonData const* dungeon)
@@ -17,10 +17,12 @@
 
 #include "Chat.h"
 #include "ChatPackets.h"
+#include "DatabaseEnv.h"
 #include "RBAC.h"
 #include "GameTime.h"
 #include "Metric.h"
 #include "Player.h"
+#include "UpdateTime.h"
 #include "World.h"
 #include "WorldSession.h"
 #include "WorldSessionMgr.h"
@@ -39,6 +41,9 @@ WorldSessionMgr::WorldSessionMgr()
     _playerCount = 0;
     _maxPlayerCount = 0;
     _accountsPlayHistoryPruneTimer = 0;
+    _queueHeadTicket = 0;
+    _queuePositionUpdateTimer = 0;
+    _queuePositionsChanged = false;
 }
 
 WorldSessionMgr::~WorldSessionMgr()
@@ -182,6 +187,8 @@ void WorldSessionMgr::UpdateSessions(uint32 const diff)
         }
     }
 
+    UpdateLoginQueue(diff);
+
     // pussywizard:
     if (_offlineSessions.empty())
         return;
@@ -220,6 +227,7 @@ bool WorldSessionMgr::KickSession(uint32 id)
 void WorldSessionMgr::KickAll()
 {
     _queuedPlayer.clear();                                 // prevent send queue update packet and login queued sessions
+    _queuedPlayerEntries.clear();
 
     // session not removed at kick and will removed in next update tick
     for (SessionMap::const_iterator itr = _sessions.begin(); itr != _sessions.end(); ++itr)
@@ -247,69 +255,140 @@ void WorldSessionMgr::AddSession(WorldSession* session)
 void WorldSessionMgr::AddQueuedPlayer(WorldSession* session)
 {
     session->SetInQueue(true);
+
+    uint32 position = _queuedPlayerEntries.size() + 1;
+    _queuedPlayerEntries[session] = { _queueHeadTicket + _queuedPlayer.size(), position };
     _queuedPlayer.push_back(session);
 
     // The 1st SMSG_AUTH_RESPONSE needs to contain other info too.
-    session->SendAuthResponse(AUTH_WAIT_QUEUE, false, GetQueuePos(session));
+    session->SendAuthResponse(AUTH_WAIT_QUEUE, false, position);
 }
 
 bool WorldSessionMgr::RemoveQueuedPlayer(WorldSession* session)
 {
-    uint32 sessions = GetActiveSessionCount();
+    auto itr = _queuedPlayerEntries.find(session);
 
-    uint32 position = 1;
-    Queue::iterator iter = _queuedPlayer.begin();
+    // if session not queued then it was an active session, the freed slot is handed out by UpdateLoginQueue
+    if (itr == _queuedPlayerEntries.end())
+        return false;
+
+    _queuedPlayer[itr->second.Ticket - _queueHeadTicket] = nullptr;
+    _queuedPlayerEntries.erase(itr);
 
-    // search to remove and count skipped positions
-    bool found = false;
+    session->SetInQueue(false);
+    session->ResetTimeOutTime(false);
 
-    for (; iter != _queuedPlayer.end(); ++iter, ++position)
+    while (!_queuedPlayer.empty() && !_queuedPlayer.front())
     {
-        if (*iter == session)
+        _queuedPlayer.pop_front();
+        ++_queueHeadTicket;
+    }
+
+    _queuePositionsChanged = true;
+    return true;
+}
+
+int32 WorldSessionMgr::GetQueuePos(WorldSession* session)
+{
+    auto itr = _queuedPlayerEntries.find(session);
+    if (itr == _queuedPlayerEntries.end())
+        return 0;
+
+    return itr->second.Position;
+}
+
+void WorldSessionMgr::UpdateLoginQueue(uint32 diff)
+{
+    METRIC_VALUE("login_queue_size", uint64(_queuedPlayerEntries.size()));
+
+    if (_queuedPlayerEntries.empty())
+        return;
+
+    uint32 const limit = GetPlayerAmountLimit();
+    uint32 const activeSessions = GetActiveSessionCount();
+    uint32 freeSlots = _queuedPlayerEntries.size();
+    if (limit)
+        freeSlots = activeSessions < limit ? std::min(freeSlots, limit - activeSessions) : 0;
+
+    uint32 admitted = 0;
+    if (freeSlots)
+    {
+        uint32 const budget = std::min(freeSlots, GetLoginQueueAdmissionBudget());
+        while (admitted < budget && !_queuedPlayer.empty())
         {
-            session->SetInQueue(false);
-            session->ResetTimeOutTime(false);
-            iter = _queuedPlayer.erase(iter);
-            found = true;
-            break;
+            WorldSession* session = _queuedPlayer.front();
+            _queuedPlayer.pop_front();
+            ++_queueHeadTicket;
+
+            if (!session)
+                continue;
+
+            _queuedPlayerEntries.erase(session);
+            session->InitializeSession();
+            ++admitted;
         }
+
+        if (admitted)
+            _queuePositionsChanged = true;
     }
 
-    // if session not queued then it was an active session
-    if (!found)
+    METRIC_VALUE("login_queue_admitted", admitted);
+
+    _queuePositionUpdateTimer += diff;
+    if (_queuePositionsChanged && _queuePositionUpdateTimer >= sWorld->getIntConfig(CONFIG_LOGIN_QUEUE_POSITION_UPDATE_INTERVAL))
     {
-        ASSERT(sessions > 0);
-        --sessions;
+        _queuePositionUpdateTimer = 0;
+        RefreshQueuePositions();
     }
+}
+
+uint32 WorldSessionMgr::GetLoginQueueAdmissionBudget() const
+{
+    uint32 budget = std::max<uint32>(sWorld->getIntConfig(CONFIG_LOGIN_QUEUE_BATCH_SIZE), 1);
 
-    // accept first in queue
-    if ((!GetPlayerAmountLimit() || sessions < GetPlayerAmountLimit()) && !_queuedPlayer.empty())
+    // Every admitted session fires account data queries and shortly after a character login query holder,
+    // hold admissions while the character database is still working through the previous batch
+    if (uint32 maxDbQueueSize = sWorld->getIntConfig(CONFIG_LOGIN_QUEUE_MAX_DB_QUEUE_SIZE))
     {
-        WorldSession* pop_sess = _queuedPlayer.front();
-        pop_sess->InitializeSession();
-        _queuedPlayer.pop_front();
+        std::size_t dbQueueSize = CharacterDatabase.QueueSize();
+        if (dbQueueSize >= maxDbQueueSize)
+            return 0;
 
-        // update iter to point first queued socket or end() if queue is empty now
-        iter = _queuedPlayer.begin();
-        position = 1;
+        budget = std::max<uint32>(budget * (maxDbQueueSize - dbQueueSize) / maxDbQueueSize, 1);
     }
 
-    // update queue position from iter to end()
-    for (; iter != _queuedPlayer.end(); ++iter, ++position)
-        (*iter)->SendAuthWaitQueue(position);
+    // Maps are already struggling, let players in one at a time
+    if (uint32 maxUpdateTime = sWorld->getIntConfig(CONFIG_LOGIN_QUEUE_MAX_UPDATE_TIME))
+        if (sWorldUpdateTime.GetAverageUpdateTime() > maxUpdateTime)
+            budget = 1;
 
-    return found;
+    return budget;
 }
 
-int32 WorldSessionMgr::GetQueuePos(WorldSession* session)
+void WorldSessionMgr::RefreshQueuePositions()
 {
+    _queuePositionsChanged = false;
+
+    Queue compacted;
     uint32 position = 1;
+    for (WorldSession* session : _queuedPlayer)
+    {
+        if (!session)
+            continue;
 
-    for (Queue::const_iterator iter = _queuedPlayer.begin(); iter != _queuedPlayer.end(); ++iter, ++position)
-        if ((*iter) == session)
-            return position;
+        QueueEntry& entry = _queuedPlayerEntries[session];
+        entry.Ticket = _queueHeadTicket + compacted.size();
+        if (entry.Position != position)
+        {
+            entry.Position = position;
+            session->SendAuthWaitQueue(position);
+        }
+
+        compacted.push_back(session);
+        ++position;
+    }
 
-    return 0;
+    _queuedPlayer = std::move(compacted);
 }
 
 void WorldSessionMgr::AddSession_(WorldSession* session)
@@ -418,8 +497,8 @@ bool WorldSessionMgr::HasRecentlyDisconnected(WorldSession* session)
 
 void WorldSessionMgr::UpdateMaxSessionCounters()
 {
-    _maxActiveSessionCount = std::max(_maxActiveSessionCount, uint32(_sessions.size() - _queuedPlayer.size()));
-    _maxQueuedSessionCount = std::max(_maxQueuedSessionCount, uint32(_queuedPlayer.size()));
+    _maxActiveSessionCount = std::max(_maxActiveSessionCount, GetActiveSessionCount());
+    _maxQueuedSessionCount = std::max(_maxQueuedSessionCount, GetQueuedSessionCount());
 }
 
 /// Send a packet to all players (except self if mentioned)
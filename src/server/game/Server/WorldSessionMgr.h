@@ -23,7 +23,7 @@
 #include "IWorld.h"
 #include "LockedQueue.h"
 #include "ObjectGuid.h"
-#include <list>
+#include <deque>
 #include <map>
 #include <unordered_map>
 
@@ -58,6 +58,7 @@ public:
 
     void AddQueuedPlayer(WorldSession* session);
     bool RemoveQueuedPlayer(WorldSession* session);
+    /// Position last sent to the session, refreshed every LoginQueue.PositionUpdateInterval
     int32 GetQueuePos(WorldSession* session);
     bool HasRecentlyDisconnected(WorldSession* session);
 
@@ -67,8 +68,8 @@ public:
     /// Get the number of current active sessions
     void UpdateMaxSessionCounters();
     uint32 GetActiveAndQueuedSessionCount() const { return _sessions.size(); }
-    uint32 GetActiveSessionCount() const { return _sessions.size() - _queuedPlayer.size(); }
-    uint32 GetQueuedSessionCount() const { return _queuedPlayer.size(); }
+    uint32 GetActiveSessionCount() const { return _sessions.size() - _queuedPlayerEntries.size(); }
+    uint32 GetQueuedSessionCount() const { return _queuedPlayerEntries.size(); }
     /// Get the maximum number of parallel sessions on the server since last reboot
     uint32 GetMaxQueuedSessionCount() const { return _maxQueuedSessionCount; }
     uint32 GetMaxActiveSessionCount() const { return _maxActiveSessionCount; }
@@ -97,6 +98,12 @@ private:
     LockedQueue<WorldSession*> _addSessQueue;
     void AddSession_(WorldSession* session);
 
+    /// Promotes queued sessions in batches and sends rate limited position updates
+    void UpdateLoginQueue(uint32 diff);
+    /// Number of queued sessions that may start loading this tick, based on character database and world load
+    uint32 GetLoginQueueAdmissionBudget() const;
+    void RefreshQueuePositions();
+
     SessionMap _sessions;
     SessionMap _offlineSessions;
     std::map<uint32 /*accountId*/, AccountPlayHistory> _accountsPlayHistory;
@@ -104,8 +111,19 @@ private:
     typedef std::unordered_map<uint32, time_t> DisconnectMap;
     DisconnectMap _disconnects;
 
-    typedef std::list<WorldSession*> Queue;
+    struct QueueEntry
+    {
+        uint64 Ticket;
+        uint32 Position;
+    };
+
+    // Sessions leaving the queue out of order leave a nullptr slot behind, compacted on the next position refresh
+    typedef std::deque<WorldSession*> Queue;
     Queue _queuedPlayer;
+    std::unordered_map<WorldSession*, QueueEntry> _queuedPlayerEntries;
+    uint64 _queueHeadTicket;
+    uint32 _queuePositionUpdateTimer;
+    bool _queuePositionsChanged;
 
     uint32 _playerLimit;
     uint32 _maxActiveSessionCount;
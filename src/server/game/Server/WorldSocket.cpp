@@ -180,26 +180,28 @@ bool WorldSocket::Update()
 
             currentPacketSize = queued->size() + header.getHeaderLength();
 
-            if (buffer.GetRemainingSpace() < currentPacketSize)
+            if (currentPacketSize > _sendBufferSize) // Single packet larger than send buffer size
             {
-                QueuePacket(std::move(buffer));
-                buffer.Resize(_sendBufferSize);
-            }
+                // Keep the (possibly encrypted) header inline and reference the payload instead of copying it,
+                // both end up in the same scatter/gather write
+                if (buffer.GetRemainingSpace() < header.getHeaderLength())
+                {
+                    QueuePacket(std::move(buffer));
+                    buffer.Resize(_sendBufferSize);
+                }
 
-            if (buffer.GetRemainingSpace() >= currentPacketSize)
-            {
                 buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                QueuePacket(std::move(buffer));
+                QueuePacket(MessageBuffer(queued->Move()));
+                buffer.Resize(_sendBufferSize);
             }
-            else    // Single packet larger than current buffer size
+            else
             {
-                // Resize buffer to fit current packet
-                buffer.Resize(currentPacketSize);
-
-                // Grow future buffers to current packet size if still below limit
-                if (currentPacketSize <= 65536)
-                    _sendBufferSize = currentPacketSize;
+                if (buffer.GetRemainingSpace() < currentPacketSize)
+                {
+                    QueuePacket(std::move(buffer));
+                    buffer.Resize(_sendBufferSize);
+                }
 
                 buffer.Write(header.header, header.getHeaderLength());
                 if (!queued->empty())
@@ -291,7 +291,7 @@ public:
     uint32    ItemType;
     uint32    TriggerSpell;
     flag96    SpellClassMask;
-    std::list<Condition*>* ImplicitTargetConditions;
+    std::vector<Condition*>* ImplicitTargetConditions;
 
     SpellEffectInfo() : _spellInfo(nullptr), EffectIndex(0), Effect(0), ApplyAuraName(SPELL_AURA_NONE), Amplitude(0), DieSides(0),
         RealPointsPerLevel(0), BasePoints(0), PointsPerComboPoint(0), ValueMultiplier(0), DamageMultiplier(0),
@@ -341,10 +341,12 @@ class AC_GAME_API SpellInfo
 friend class SpellMgr;
 
 public:
-    uint32 Id;
-    SpellCategoryEntry const* CategoryEntry;
-    uint32 Dispel;
-    uint32 Mechanic;
+    // Members are grouped by access frequency: the block starting at Id is read on
+    // nearly every cast, proc and aura check, the trailing block (names, visuals,
+    // reagents) is only touched by loaders, commands and client packets. Aligning Id
+    // makes every SpellInfo in SpellMgr's contiguous store start on a cache line, so
+    // the hot block always spans the same three lines.
+    alignas(64) uint32 Id;
     uint32 Attributes;
     uint32 AttributesEx;
     uint32 AttributesEx2;
@@ -354,12 +356,44 @@ public:
     uint32 AttributesEx6;
     uint32 AttributesEx7;
     uint32 AttributesCu;
+    uint32 SchoolMask;
+    uint32 DmgClass;
+    uint32 SpellFamilyName;
+    flag96 SpellFamilyFlags;
+    uint32 ProcFlags;
+    uint32 ProcChance;
+    uint32 ProcCharges;
+    uint32 Mechanic;
+    uint32 Dispel;
+    uint32 ExplicitTargetMask;
+    uint32 InterruptFlags;
+    uint32 AuraInterruptFlags;
+    uint32 ChannelInterruptFlags;
+    uint32 PreventionType;
+    uint32 MaxAffectedTargets;
+    uint32 StackAmount;
+    SpellRangeEntry const* RangeEntry;
+    SpellCastTimesEntry const* CastTimeEntry;
+    SpellDurationEntry const* DurationEntry;
+    SpellCategoryEntry const* CategoryEntry;
+    SpellChainNode const* ChainEntry;
+    float  Speed;
+
+    // Mine
+    AuraStateType _auraState;
+    SpellSpecificType _spellSpecific;
+    bool _isStackableWithRanks;
+    bool _isSpellValid;
+    bool _isCritCapable;
+    bool _requireCooldownInfo;
+    float JumpDistance;
+
+    std::array<SpellEffectInfo, MAX_SPELL_EFFECTS> Effects;
+
     uint32 Stances;
     uint32 StancesNot;
     uint32 Targets;
     uint32 TargetCreatureType;
-    uint32 RequiresSpellFocus;
-    uint32 FacingCasterFlags;
     uint32 CasterAuraState;
     uint32 TargetAuraState;
     uint32 CasterAuraStateNot;
@@ -368,21 +402,14 @@ public:
     uint32 TargetAuraSpell;
     uint32 ExcludeCasterAuraSpell;
     uint32 ExcludeTargetAuraSpell;
-    SpellCastTimesEntry const* CastTimeEntry;
     uint32 RecoveryTime;
     uint32 CategoryRecoveryTime;
     uint32 StartRecoveryCategory;
     uint32 StartRecoveryTime;
-    uint32 InterruptFlags;
-    uint32 AuraInterruptFlags;
-    uint32 ChannelInterruptFlags;
-    uint32 ProcFlags;
-    uint32 ProcChance;
-    uint32 ProcCharges;
     uint32 MaxLevel;
     uint32 BaseLevel;
     uint32 SpellLevel;
-    SpellDurationEntry const* DurationEntry;
+    uint32 MaxTargetLevel;
     uint32 PowerType;
     uint32 ManaCost;
     uint32 ManaCostPerlevel;
@@ -390,15 +417,18 @@ public:
     uint32 ManaPerSecondPerLevel;
     uint32 ManaCostPercentage;
     uint32 RuneCostID;
-    SpellRangeEntry const* RangeEntry;
-    float  Speed;
-    uint32 StackAmount;
-    std::array<uint32, 2> Totem;
-    std::array<int32, MAX_SPELL_REAGENTS>  Reagent;
-    std::array<uint32, MAX_SPELL_REAGENTS> ReagentCount;
     int32  EquippedItemClass;
     int32  EquippedItemSubClassMask;
     int32  EquippedItemInventoryTypeMask;
+
+    uint32 RequiresSpellFocus;
+    uint32 FacingCasterFlags;
+    int32  AreaGroupId;
+
+    // Cold data
+    std::array<uint32, 2> Totem;
+    std::array<int32, MAX_SPELL_REAGENTS>  Reagent;
+    std::array<uint32, MAX_SPELL_REAGENTS> ReagentCount;
     std::array<uint32, 2> TotemCategory;
     std::array<uint32, 2> SpellVisual;
     uint32 SpellIconID;
@@ -406,26 +436,6 @@ public:
     uint32 SpellPriority;
     std::array<char const*, 16> SpellName;
     std::array<char const*, 16> Rank;
-    uint32 MaxTargetLevel;
-    uint32 MaxAffectedTargets;
-    uint32 SpellFamilyName;
-    flag96 SpellFamilyFlags;
-    uint32 DmgClass;
-    uint32 PreventionType;
-    int32  AreaGroupId;
-    uint32 SchoolMask;
-    std::array<SpellEffectInfo, MAX_SPELL_EFFECTS> Effects;
-    uint32 ExplicitTargetMask;
-    SpellChainNode const* ChainEntry;
-
-    // Mine
-    AuraStateType _auraState;
-    SpellSpecificType _spellSpecific;
-    bool _isStackableWithRanks;
-    bool _isSpellValid;
-    bool _isCritCapable;
-    bool _requireCooldownInfo;
-    float JumpDistance;
 
     SpellInfo(SpellEntry const* spellEntry);
     ~SpellInfo();
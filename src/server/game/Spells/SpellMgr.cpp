@@ -34,6 +34,7 @@
 #include "World.h"
 
 #include <algorithm>
+#include <new>
 
 bool IsPrimaryProfessionSkill(uint32 skill)
 {
@@ -3026,8 +3027,17 @@ void SpellMgr::LoadSpellInfoStore()
     UnloadSpellInfoStore();
     mSpellInfoMap.resize(sSpellStore.GetNumRows(), nullptr);
 
+    // Construct every SpellInfo into one cache line aligned block instead of one heap
+    // allocation per spell, so lookups of neighbouring spell ids stay close in memory
+    std::size_t spellCount = 0;
+    for ([[maybe_unused]] SpellEntry const* spellEntry : sSpellStore)
+        ++spellCount;
+
+    mSpellInfoStorage = ::operator new(spellCount * sizeof(SpellInfo), std::align_val_t(alignof(SpellInfo)));
+
+    SpellInfo* spellInfoSlot = static_cast<SpellInfo*>(mSpellInfoStorage);
     for (SpellEntry const* spellEntry : sSpellStore)
-        mSpellInfoMap[spellEntry->Id] = new SpellInfo(spellEntry);
+        mSpellInfoMap[spellEntry->Id] = new (spellInfoSlot++) SpellInfo(spellEntry);
 
     for (uint32 spellIndex = 0; spellIndex < GetSpellInfoStoreSize(); ++spellIndex)
     {
@@ -3095,9 +3105,16 @@ SpellCooldownOverride SpellMgr::GetSpellCooldownOverride(uint32 spellId) const
 void SpellMgr::UnloadSpellInfoStore()
 {
     for (uint32 i = 0; i < GetSpellInfoStoreSize(); ++i)
-        delete mSpellInfoMap[i];
+        if (mSpellInfoMap[i])
+            mSpellInfoMap[i]->~SpellInfo();
 
     mSpellInfoMap.clear();
+
+    if (mSpellInfoStorage)
+    {
+        ::operator delete(mSpellInfoStorage, std::align_val_t(alignof(SpellInfo)));
+        mSpellInfoStorage = nullptr;
+    }
 }
 
 void SpellMgr::UnloadSpellInfoImplicitTargetConditionLists()
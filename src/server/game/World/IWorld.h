@@ -24,6 +24,7 @@
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
 #include "WorldConfig.h"
+#include <functional>
 #include <unordered_map>
 
 class WorldPacket;
@@ -49,6 +50,9 @@ private:
     CliCommandHolder& operator=(CliCommandHolder const& right) = delete;
 };
 
+/// Applies data prepared by a background reload, runs on the world thread and returns the number of changed entries
+using AsyncReloadApplyFunction = std::function<uint32()>;
+
 // ServerMessages.dbc
 enum ServerMessageType
 {
@@ -111,6 +115,8 @@ public:
     [[nodiscard]] virtual std::string const& GetRealmName() const = 0;
     virtual void SetRealmName(std::string name) = 0;
     virtual void ReloadRBAC() = 0;
+    virtual void ReloadAsync(std::string const& tableName, std::function<AsyncReloadApplyFunction()>&& loader) = 0;
+    [[nodiscard]] virtual bool IsAsyncReloadPending() const = 0;
 };
 
 #endif //AZEROTHCORE_IWORLD_H
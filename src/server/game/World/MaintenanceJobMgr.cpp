@@ -0,0 +1,315 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MaintenanceJobMgr.h"
+#include "DatabaseEnv.h"
+#include "GameTime.h"
+#include "Log.h"
+#include "Mail.h"
+#include "MailMgr.h"
+#include "Metric.h"
+#include "ObjectAccessor.h"
+#include "Player.h"
+#include "Timer.h"
+#include "World.h"
+#include <unordered_map>
+#include <vector>
+
+void MaintenanceJob::Start()
+{
+    _running = true;
+    _batchPending = false;
+    _cursor = 0;
+    _processedRows = 0;
+    _startTime = getMSTime();
+
+    OnStart();
+}
+
+void MaintenanceJob::FinishBatch(uint32 rows, uint32 cursor)
+{
+    _batchPending = false;
+    _cursor = cursor;
+    _processedRows += rows;
+
+    METRIC_VALUE("maintenance_job_rows", _processedRows, METRIC_TAG("job", std::string(GetName())));
+
+    // a short batch means the cursor reached the end of the table
+    if (rows < _batchSize)
+    {
+        _running = false;
+
+        uint32 runTime = GetMSTimeDiffToNow(_startTime);
+        METRIC_VALUE("maintenance_job_time", runTime, METRIC_TAG("job", std::string(GetName())));
+        LOG_INFO("server.worldserver", "Maintenance job {} processed {} rows in {} ms", GetName(), _processedRows, runTime);
+    }
+}
+
+namespace
+{
+    /// Returns expired mail with items to the sender and deletes the rest, skipping receivers that are online
+    class ExpiredMailJob : public MaintenanceJob
+    {
+    public:
+        std::string_view GetName() const override { return "expired_mail"; }
+
+    protected:
+        void OnStart() override
+        {
+            _curTime = GameTime::GetGameTime().count();
+            _deletedCount = 0;
+            _returnedCount = 0;
+        }
+
+        QueryCallback QueryBatch(uint32 cursor, uint32 batchSize) override
+        {
+            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL);
+            stmt->SetData(0, uint32(_curTime));
+            stmt->SetData(1, cursor);
+            stmt->SetData(2, batchSize);
+
+            return CharacterDatabase.AsyncQuery(stmt)
+                .WithChainingPreparedCallback([this, cursor](QueryCallback& callback, PreparedQueryResult result)
+                {
+                    _mails.clear();
+                    if (!result)
+                    {
+                        FinishBatch(0, cursor);
+                        return;
+                    }
+
+                    do
+                    {
+                        Field* fields = result->Fetch();
+                        Mail& m = _mails.emplace_back();
+                        m.messageID      = fields[0].Get<uint32>();
+                        m.messageType    = fields[1].Get<uint8>();
+                        m.sender         = fields[2].Get<uint32>();
+                        m.receiver       = fields[3].Get<uint32>();
+                        m.expire_time    = time_t(fields[5].Get<uint32>());
+                        m.deliver_time   = time_t(0);
+                        m.stationery     = fields[6].Get<uint8>();
+                        m.checked        = fields[7].Get<uint8>();
+                        m.mailTemplateId = fields[8].Get<int16>();
+                    } while (result->NextRow());
+
+                    // items of the mails in this batch, rows are ordered by id so the range covers exactly the batch
+                    CharacterDatabasePreparedStatement* itemsStmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS);
+                    itemsStmt->SetData(0, uint32(_curTime));
+                    itemsStmt->SetData(1, cursor);
+                    itemsStmt->SetData(2, _mails.back().messageID);
+                    callback.SetNextQuery(CharacterDatabase.AsyncQuery(itemsStmt));
+                })
+                .WithPreparedCallback([this](PreparedQueryResult items)
+                {
+                    std::unordered_map<uint32 /*messageId*/, MailItemInfoVec> itemsCache;
+                    if (items)
+                    {
+                        MailItemInfo item;
+                        do
+                        {
+                            Field* fields = items->Fetch();
+                            item.item_guid = fields[0].Get<uint32>();
+                            item.item_template = fields[1].Get<uint32>();
+                            itemsCache[fields[2].Get<uint32>()].push_back(item);
+                        } while (items->NextRow());
+                    }
+
+                    for (Mail& m : _mails)
+                    {
+                        // don't modify mails of a logged in player
+                        if (ObjectAccessor::FindPlayerByLowGUID(m.receiver))
+                            continue;
+
+                        auto itr = itemsCache.find(m.messageID);
+                        if (itr != itemsCache.end())
+                            m.items.swap(itr->second);
+
+                        if (sMailMgr->ReturnOrDeleteExpiredMail(m, _curTime))
+                            ++_returnedCount;
+                        else
+                            ++_deletedCount;
+                    }
+
+                    FinishBatch(_mails.size(), _mails.back().messageID);
+                    if (!IsRunning())
+                        LOG_INFO("server.worldserver", ">> Processed {} expired mails: {} deleted and {} returned", _deletedCount + _returnedCount, _deletedCount, _returnedCount);
+                });
+        }
+
+    private:
+        time_t _curTime = 0;
+        uint32 _deletedCount = 0;
+        uint32 _returnedCount = 0;
+        std::vector<Mail> _mails;
+    };
+
+    /// Removes characters unlinked by CharDelete.Method more than CharDelete.KeepDays ago
+    class OldCharactersJob : public MaintenanceJob
+    {
+    public:
+        std::string_view GetName() const override { return "old_characters"; }
+
+        // Player::DeleteFromDB still runs synchronous queries for every character
+        uint32 GetMaxBatchSize() const override { return 10; }
+
+    protected:
+        void OnStart() override
+        {
+            _deleteBefore = GameTime::GetGameTime().count() - time_t(sWorld->getIntConfig(CONFIG_CHARDELETE_KEEP_DAYS) * DAY);
+        }
+
+        QueryCallback QueryBatch(uint32 cursor, uint32 batchSize) override
+        {
+            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_OLD_CHARS_BATCH);
+            stmt->SetData(0, uint32(_deleteBefore));
+            stmt->SetData(1, cursor);
+            stmt->SetData(2, batchSize);
+
+            return CharacterDatabase.AsyncQuery(stmt).WithPreparedCallback([this, cursor](PreparedQueryResult result)
+            {
+                if (!result)
+                {
+                    FinishBatch(0, cursor);
+                    return;
+                }
+
+                uint32 guid = cursor;
+                do
+                {
+                    Field* fields = result->Fetch();
+                    guid = fields[0].Get<uint32>();
+                    Player::DeleteFromDB(guid, fields[1].Get<uint32>(), true, true);
+                } while (result->NextRow());
+
+                FinishBatch(result->GetRowCount(), guid);
+            });
+        }
+
+    private:
+        time_t _deleteBefore = 0;
+    };
+
+    /// Removes recovery_item rows of items deleted more than ItemDelete.KeepDays ago
+    class OldRecoveryItemsJob : public MaintenanceJob
+    {
+    public:
+        std::string_view GetName() const override { return "old_recovery_items"; }
+
+    protected:
+        void OnStart() override
+        {
+            _deleteBefore = GameTime::GetGameTime().count() - time_t(sWorld->getIntConfig(CONFIG_ITEMDELETE_KEEP_DAYS) * DAY);
+        }
+
+        QueryCallback QueryBatch(uint32 cursor, uint32 batchSize) override
+        {
+            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_RECOVERY_ITEM_OLD_ITEMS);
+            stmt->SetData(0, uint32(_deleteBefore));
+            stmt->SetData(1, cursor);
+            stmt->SetData(2, batchSize);
+
+            return CharacterDatabase.AsyncQuery(stmt).WithPreparedCallback([this, cursor](PreparedQueryResult result)
+            {
+                if (!result)
+                {
+                    FinishBatch(0, cursor);
+                    return;
+                }
+
+                uint32 guid = cursor;
+                do
+                {
+                    Field* fields = result->Fetch();
+
+                    // a character can have several rows, the first one removes all of them
+                    if (fields[0].Get<uint32>() == guid)
+                        continue;
+
+                    guid = fields[0].Get<uint32>();
+
+                    CharacterDatabasePreparedStatement* deleteStmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_RECOVERY_ITEM_BY_GUID);
+                    deleteStmt->SetData(0, guid);
+                    CharacterDatabase.Execute(deleteStmt);
+
+                    LOG_DEBUG("server.worldserver", "Deleted item from recovery_item table where guid {} and item id {}", guid, fields[1].Get<uint32>());
+                } while (result->NextRow());
+
+                FinishBatch(result->GetRowCount(), guid);
+            });
+        }
+
+    private:
+        time_t _deleteBefore = 0;
+    };
+}
+
+MaintenanceJobMgr::MaintenanceJobMgr() : _batchTimer(0), _nextJob(0)
+{
+    _jobs[MAINTENANCE_JOB_EXPIRED_MAIL] = std::make_unique<ExpiredMailJob>();
+    _jobs[MAINTENANCE_JOB_OLD_CHARACTERS] = std::make_unique<OldCharactersJob>();
+    _jobs[MAINTENANCE_JOB_OLD_RECOVERY_ITEMS] = std::make_unique<OldRecoveryItemsJob>();
+}
+
+MaintenanceJobMgr::~MaintenanceJobMgr() = default;
+
+MaintenanceJobMgr* MaintenanceJobMgr::instance()
+{
+    static MaintenanceJobMgr instance;
+    return &instance;
+}
+
+void MaintenanceJobMgr::StartJob(MaintenanceJobType type)
+{
+    MaintenanceJob* job = _jobs[type].get();
+    if (job->IsRunning())
+        return;
+
+    LOG_INFO("server.worldserver", "Starting maintenance job {}", job->GetName());
+    job->Start();
+}
+
+bool MaintenanceJobMgr::IsJobRunning(MaintenanceJobType type) const
+{
+    return _jobs[type]->IsRunning();
+}
+
+void MaintenanceJobMgr::Update(uint32 diff)
+{
+    _queryProcessor.ProcessReadyCallbacks();
+
+    _batchTimer += diff;
+    if (_batchTimer < sWorld->getIntConfig(CONFIG_MAINTENANCE_BATCH_INTERVAL))
+        return;
+
+    // one batch per interval over all jobs, in turns
+    for (uint8 i = 0; i < MAX_MAINTENANCE_JOBS; ++i)
+    {
+        uint8 type = (_nextJob + i) % MAX_MAINTENANCE_JOBS;
+        MaintenanceJob* job = _jobs[type].get();
+        if (!job->_running || job->_batchPending)
+            continue;
+
+        job->_batchPending = true;
+        job->_batchSize = std::max(1u, std::min(sWorld->getIntConfig(CONFIG_MAINTENANCE_BATCH_SIZE), job->GetMaxBatchSize()));
+        _queryProcessor.AddCallback(job->QueryBatch(job->_cursor, job->_batchSize));
+
+        _nextJob = (type + 1) % MAX_MAINTENANCE_JOBS;
+        _batchTimer = 0;
+        break;
+    }
+}
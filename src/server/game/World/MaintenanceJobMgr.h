@@ -0,0 +1,116 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MAINTENANCE_JOB_MGR_H
+#define _MAINTENANCE_JOB_MGR_H
+
+#include "AsyncCallbackProcessor.h"
+#include "DatabaseEnvFwd.h"
+#include "Define.h"
+#include "QueryCallback.h"
+#include <array>
+#include <limits>
+#include <memory>
+#include <string_view>
+
+enum MaintenanceJobType : uint8
+{
+    MAINTENANCE_JOB_EXPIRED_MAIL,
+    MAINTENANCE_JOB_OLD_CHARACTERS,
+    MAINTENANCE_JOB_OLD_RECOVERY_ITEMS,
+
+    MAX_MAINTENANCE_JOBS
+};
+
+/**
+ * @brief A cleanup task that walks its table in primary key order, one bounded
+ * batch at a time.
+ *
+ * Batches are read with async queries and the rows are handled on the world
+ * thread once the result arrives, so no single world update waits on the full scan.
+ */
+class AC_GAME_API MaintenanceJob
+{
+public:
+    virtual ~MaintenanceJob() = default;
+
+    [[nodiscard]] virtual std::string_view GetName() const = 0;
+
+    /// Upper bound for the batch size, for jobs whose rows are expensive to handle
+    [[nodiscard]] virtual uint32 GetMaxBatchSize() const { return std::numeric_limits<uint32>::max(); }
+
+    [[nodiscard]] bool IsRunning() const { return _running; }
+
+protected:
+    /// Called when a run starts, before the first batch is queried
+    virtual void OnStart() { }
+
+    /**
+     * @brief Builds the async query for the rows after the cursor.
+     * The callback must end with FinishBatch(), also when the query returned nothing.
+     */
+    virtual QueryCallback QueryBatch(uint32 cursor, uint32 batchSize) = 0;
+
+    /**
+     * @brief Reports a handled batch.
+     * @param rows Number of rows the batch query returned
+     * @param cursor Key of the last row, the next batch starts after it
+     */
+    void FinishBatch(uint32 rows, uint32 cursor);
+
+private:
+    friend class MaintenanceJobMgr;
+
+    void Start();
+
+    bool _running = false;
+    bool _batchPending = false;
+    uint32 _batchSize = 0;
+    uint32 _cursor = 0;
+    uint32 _processedRows = 0;
+    uint32 _startTime = 0;
+};
+
+/**
+ * @brief Runs the background maintenance jobs (expired mail, old deleted
+ * characters and recovery items) at a limited rate: at most one batch of
+ * MaintenanceJobs.BatchSize rows is queried every MaintenanceJobs.BatchInterval ms.
+ */
+class AC_GAME_API MaintenanceJobMgr
+{
+public:
+    static MaintenanceJobMgr* instance();
+
+    /// Starts a run of the job, does nothing if it is already running
+    void StartJob(MaintenanceJobType type);
+    [[nodiscard]] bool IsJobRunning(MaintenanceJobType type) const;
+
+    void Update(uint32 diff);
+
+private:
+    MaintenanceJobMgr();
+    ~MaintenanceJobMgr();
+
+    std::array<std::unique_ptr<MaintenanceJob>, MAX_MAINTENANCE_JOBS> _jobs;
+    QueryCallbackProcessor _queryProcessor;
+    uint32 _batchTimer;
+    uint8 _nextJob;
+};
+
+#define sMaintenanceJobMgr MaintenanceJobMgr::instance()
+
+#endif
@@ -46,6 +46,7 @@
 #include "DatabaseEnv.h"
 #include "DisableMgr.h"
 #include "DynamicVisibility.h"
+#include "FrameArena.h"
 #include "GameEventMgr.h"
 #include "GameGraveyard.h"
 #include "GameTime.h"
@@ -61,6 +62,7 @@
 #include "Log.h"
 #include "LootItemStorage.h"
 #include "LootMgr.h"
+#include "MaintenanceJobMgr.h"
 #include "M2Stores.h"
 #include "MailMgr.h"
 #include "MapMgr.h"
@@ -186,6 +188,8 @@ void World::LoadConfigSettings(bool reload)
     // load update time related configs
     sWorldUpdateTime.LoadFromConfig();
 
+    DynamicVisibilityMgr::LoadFromConfig();
+
     ///- Read the player limit and the Message of the day from the config file
     if (!reload)
         sWorldSessionMgr->SetPlayerAmountLimit(sConfigMgr->GetOption<int32>("PlayerLimit", 1000));
@@ -847,10 +851,8 @@ void World::SetInitialWorldSettings()
     CharacterDatabase.Execute("DELETE mi FROM mail_items mi LEFT JOIN mail m ON mi.mail_id = m.id WHERE m.id IS NULL");
     CharacterDatabase.Execute("UPDATE mail m LEFT JOIN mail_items mi ON m.id = mi.mail_id SET m.has_items=0 WHERE m.has_items<>0 AND mi.mail_id IS NULL");
 
-    ///- Handle outdated emails (delete/return)
-    LOG_INFO("server.loading", "Returning Old Mails...");
-    LOG_INFO("server.loading", " ");
-    sMailMgr->ReturnOrDeleteOldMails(false);
+    ///- Handle outdated emails (delete/return) in the background once the world is running
+    sMaintenanceJobMgr->StartJob(MAINTENANCE_JOB_EXPIRED_MAIL);
 
     ///- Load AutoBroadCast
     LOG_INFO("server.loading", "Loading Autobroadcasts...");
@@ -937,10 +939,12 @@ void World::SetInitialWorldSettings()
     sWorldState->Load(); // must be called after loading game events
 
     // Delete all characters which have been deleted X days before
-    Player::DeleteOldCharacters();
+    if (getIntConfig(CONFIG_CHARDELETE_KEEP_DAYS))
+        sMaintenanceJobMgr->StartJob(MAINTENANCE_JOB_OLD_CHARACTERS);
 
     // Delete all items which have been deleted X days before
-    Player::DeleteOldRecoveryItems();
+    if (getIntConfig(CONFIG_ITEMDELETE_KEEP_DAYS))
+        sMaintenanceJobMgr->StartJob(MAINTENANCE_JOB_OLD_RECOVERY_ITEMS);
 
     // Delete all custom channels which haven't been used for PreserveCustomChannelDuration days.
     Channel::CleanOldChannelsInDB();
@@ -1120,6 +1124,8 @@ void World::Update(uint32 diff)
 {
     METRIC_TIMER("world_update_time_total");
 
+    Acore::FrameArena::Instance().Reset();
+
     ///- Update the game time and check for shutdown time
     _UpdateGameTime();
     Seconds currentGameTime = GameTime::GetGameTime();
@@ -1129,8 +1135,6 @@ void World::Update(uint32 diff)
     // Record update if recording set in log and diff is greater then minimum set in log
     sWorldUpdateTime.RecordUpdateTime(GameTime::GetGameTimeMS(), diff, sWorldSessionMgr->GetActiveSessionCount());
 
-    DynamicVisibilityMgr::Update(sWorldSessionMgr->GetActiveSessionCount());
-
     ///- Update the different timers
     for (int i = 0; i < WUPDATE_COUNT; ++i)
     {
@@ -1206,10 +1210,15 @@ void World::Update(uint32 diff)
 
     if (currentGameTime > _mail_expire_check_timer)
     {
-        sMailMgr->ReturnOrDeleteOldMails(true);
+        sMaintenanceJobMgr->StartJob(MAINTENANCE_JOB_EXPIRED_MAIL);
         _mail_expire_check_timer = currentGameTime + 6h;
     }
 
+    {
+        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update maintenance jobs"));
+        sMaintenanceJobMgr->Update(diff);
+    }
+
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update sessions"));
         sWorldSessionMgr->UpdateSessions(diff);
@@ -1901,6 +1910,43 @@ void World::UpdateAreaDependentAuras()
 void World::ProcessQueryCallbacks()
 {
     _queryProcessor.ProcessReadyCallbacks();
+    _asyncReloadProcessor.ProcessReadyCallbacks();
+}
+
+void World::ReloadAsync(std::string const& tableName, std::function<AsyncReloadApplyFunction()>&& loader)
+{
+    // The loader queries and validates the table on a background thread, the returned function
+    // then swaps the changed entries in here, after the maps finished updating
+    _asyncReloadProcessor.AddCallback(AsyncReloadCallback(tableName, std::async(std::launch::async, std::move(loader))));
+}
+
+bool AsyncReloadCallback::InvokeIfReady()
+{
+    if (_future.wait_for(0s) != std::future_status::ready)
+        return false;
+
+    AsyncReloadApplyFunction apply;
+
+    try
+    {
+        apply = _future.get();
+    }
+    catch (std::exception const& e)
+    {
+        // The live data was not touched, the table can simply be reloaded again
+        LOG_ERROR("server.loading", ">> Background reload of `{}` failed, nothing applied: {}", _tableName, e.what());
+        ChatHandler(nullptr).SendGlobalGMSysMessage(Acore::StringFormat("DB table `{}` reload failed, nothing applied: {}", _tableName, e.what()).c_str());
+        return true;
+    }
+
+    uint32 const oldMSTime = getMSTime();
+    uint32 const changed = apply();
+    uint32 const pause = GetMSTimeDiffToNow(oldMSTime);
+
+    LOG_INFO("server.loading", ">> Reloaded `{}` in the background, {} changed entries applied in {} ms", _tableName, changed, pause);
+    METRIC_VALUE("world_reload_pause", pause, METRIC_TAG("table", _tableName));
+    ChatHandler(nullptr).SendGlobalGMSysMessage(Acore::StringFormat("DB table `{}` reloaded: {} changed entries, world paused {} ms.", _tableName, changed, pause).c_str());
+    return true;
 }
 
 bool World::IsPvPRealm() const
@@ -29,6 +29,7 @@
 #include "SharedDefines.h"
 #include "Timer.h"
 #include <atomic>
+#include <future>
 #include <list>
 #include <map>
 #include <unordered_map>
@@ -130,6 +131,20 @@ struct PetitionData
 {
 };
 
+/// Hands the data of a background reload over to the world thread, or reports why it failed
+class AsyncReloadCallback
+{
+public:
+    AsyncReloadCallback(std::string tableName, std::future<AsyncReloadApplyFunction>&& future)
+        : _tableName(std::move(tableName)), _future(std::move(future)) { }
+
+    bool InvokeIfReady();
+
+private:
+    std::string _tableName;
+    std::future<AsyncReloadApplyFunction> _future;
+};
+
 /// The World
 class World: public IWorld
 {
@@ -236,6 +251,8 @@ public:
     void   SetCleaningFlags(uint32 flags) override { _cleaningFlags = flags; }
     void   ResetEventSeasonalQuests(uint16 event_id) override;
     void   ReloadRBAC() override;
+    void   ReloadAsync(std::string const& tableName, std::function<AsyncReloadApplyFunction()>&& loader) override;
+    [[nodiscard]] bool IsAsyncReloadPending() const override { return !_asyncReloadProcessor.IsEmpty(); }
 
     [[nodiscard]] std::string const& GetRealmName() const override { return _realmName; } // pussywizard
     void SetRealmName(std::string name) override { _realmName = name; } // pussywizard
@@ -305,6 +322,7 @@ private:
 
     void ProcessQueryCallbacks();
     QueryCallbackProcessor _queryProcessor;
+    AsyncCallbackProcessor<AsyncReloadCallback> _asyncReloadProcessor;
 
     /**
      * @brief Executed when a World Session is being finalized. Be it from a normal login or via queue popping.
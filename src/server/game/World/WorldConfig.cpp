@@ -167,6 +167,10 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<uint32>(CONFIG_PRESERVE_CUSTOM_CHANNEL_DURATION, "PreserveCustomChannelDuration", 14);
     SetConfigValue<uint32>(CONFIG_INTERVAL_SAVE, "PlayerSaveInterval", 900000);
     SetConfigValue<uint32>(CONFIG_INTERVAL_DISCONNECT_TOLERANCE, "DisconnectToleranceInterval", 0);
+    SetConfigValue<uint32>(CONFIG_LOGIN_QUEUE_BATCH_SIZE, "LoginQueue.BatchSize", 25);
+    SetConfigValue<uint32>(CONFIG_LOGIN_QUEUE_MAX_DB_QUEUE_SIZE, "LoginQueue.MaxDatabaseQueueSize", 200);
+    SetConfigValue<uint32>(CONFIG_LOGIN_QUEUE_MAX_UPDATE_TIME, "LoginQueue.MaxUpdateTime", 150);
+    SetConfigValue<uint32>(CONFIG_LOGIN_QUEUE_POSITION_UPDATE_INTERVAL, "LoginQueue.PositionUpdateInterval", 5000);
     SetConfigValue<bool>(CONFIG_STATS_SAVE_ONLY_ON_LOGOUT, "PlayerSave.Stats.SaveOnlyOnLogout", true);
     SetConfigValue<uint32>(CONFIG_ADDITIONAL_SAVES, "PlayerSave.AdditionalSaves", 0);
     SetConfigValue<bool>(CONFIG_VALIDATE_SKILL_LEARNED_BY_SPELLS, "ValidateSkillLearnedBySpells", true);
@@ -291,6 +295,10 @@ void WorldConfig::BuildConfigCache()
 
     SetConfigValue<uint32>(CONFIG_GROUP_VISIBILITY, "Visibility.GroupMode", 1);
 
+    SetConfigValue<float>(CONFIG_INTEREST_NEAR_DISTANCE, "Visibility.Interest.NearDistance", 50.0f);
+    SetConfigValue<uint32>(CONFIG_INTEREST_FAR_UPDATE_INTERVAL, "Visibility.Interest.FarUpdateInterval", 1000);
+    SetConfigValue<uint32>(CONFIG_INTEREST_FAR_HEARTBEAT_RATE, "Visibility.Interest.FarHeartbeatRate", 3);
+
     SetConfigValue<bool>(CONFIG_OBJECT_SPARKLES, "Visibility.ObjectSparkles", true);
 
     SetConfigValue<bool>(CONFIG_LOW_LEVEL_REGEN_BOOST, "EnableLowLevelRegenBoost", true);
@@ -506,6 +514,10 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<uint32>(CONFIG_ITEMDELETE_ITEM_LEVEL, "ItemDelete.ItemLevel", 80);
     SetConfigValue<uint32>(CONFIG_ITEMDELETE_KEEP_DAYS, "ItemDelete.KeepDays", 0);
 
+    ///- Load the background maintenance job related config options
+    SetConfigValue<uint32>(CONFIG_MAINTENANCE_BATCH_SIZE, "MaintenanceJobs.BatchSize", 500, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value > 0; }, "> 0");
+    SetConfigValue<uint32>(CONFIG_MAINTENANCE_BATCH_INTERVAL, "MaintenanceJobs.BatchInterval", 1000);
+
     SetConfigValue<uint32>(CONFIG_FFA_PVP_TIMER, "FFAPvPTimer", 30);
 
     SetConfigValue<float>(CONFIG_OUTDOOR_PVP_CAPTURE_RATE, "OutdoorPvPCaptureRate", 1.0f);
@@ -544,6 +556,7 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<uint32>(CONFIG_RESPAWN_DYNAMICMINIMUM_GAMEOBJECT, "Respawn.DynamicMinimumGameObject", 10);
     SetConfigValue<bool>(CONFIG_RESPAWN_DYNAMIC_ESCORTNPC, "Respawn.DynamicEscortNPC", false);
     SetConfigValue<bool>(CONFIG_RESPAWN_FORCE_COMPATIBILITY_MODE, "Respawn.ForceCompatibilityMode", false);
+    SetConfigValue<uint32>(CONFIG_RESPAWN_SAVE_INTERVAL, "Respawn.SaveInterval", 5000);
 
     SetConfigValue<bool>(CONFIG_VMAP_INDOOR_CHECK, "vmap.enableIndoorCheck", true);
     SetConfigValue<bool>(CONFIG_VMAP_ENABLE_LOS, "vmap.enableLOS", true);
@@ -552,6 +565,7 @@ void WorldConfig::BuildConfigCache()
 
     SetConfigValue<bool>(CONFIG_VMAP_BLIZZLIKE_PVP_LOS, "vmap.BlizzlikePvPLOS", true);
     SetConfigValue<bool>(CONFIG_VMAP_BLIZZLIKE_LOS_OPEN_WORLD, "vmap.BlizzlikeLOSInOpenWorld", true);
+    SetConfigValue<bool>(CONFIG_VMAP_LOS_CACHE, "vmap.LOSCache", true);
 
     SetConfigValue<bool>(CONFIG_START_CUSTOM_SPELLS, "PlayerStart.CustomSpells", false);
     SetConfigValue<uint32>(CONFIG_HONOR_AFTER_DUEL, "HonorPointsAfterDuel", 0);
@@ -135,6 +135,7 @@ enum ServerConfigs
     CONFIG_QUEST_POI_ENABLED,
     CONFIG_VMAP_BLIZZLIKE_PVP_LOS,
     CONFIG_VMAP_BLIZZLIKE_LOS_OPEN_WORLD,
+    CONFIG_VMAP_LOS_CACHE,
     CONFIG_OBJECT_SPARKLES,
     CONFIG_LOW_LEVEL_REGEN_BOOST,
     CONFIG_OBJECT_QUEST_MARKERS,
@@ -169,6 +170,10 @@ enum ServerConfigs
     CONFIG_INTERVAL_MAPUPDATE,
     CONFIG_INTERVAL_CHANGEWEATHER,
     CONFIG_INTERVAL_DISCONNECT_TOLERANCE,
+    CONFIG_LOGIN_QUEUE_BATCH_SIZE,
+    CONFIG_LOGIN_QUEUE_MAX_DB_QUEUE_SIZE,
+    CONFIG_LOGIN_QUEUE_MAX_UPDATE_TIME,
+    CONFIG_LOGIN_QUEUE_POSITION_UPDATE_INTERVAL,
     CONFIG_INTERVAL_SAVE,
     CONFIG_PORT_WORLD,
     CONFIG_SOCKET_TIMEOUTTIME,
@@ -216,6 +221,9 @@ enum ServerConfigs
     CONFIG_GM_LEVEL_IN_WHO_LIST,
     CONFIG_START_GM_LEVEL,
     CONFIG_GROUP_VISIBILITY,
+    CONFIG_INTEREST_NEAR_DISTANCE,
+    CONFIG_INTEREST_FAR_UPDATE_INTERVAL,
+    CONFIG_INTEREST_FAR_HEARTBEAT_RATE,
     CONFIG_MAIL_DELIVERY_DELAY,
     CONFIG_UPTIME_UPDATE,
     CONFIG_SKILL_CHANCE_ORANGE,
@@ -356,6 +364,8 @@ enum ServerConfigs
     CONFIG_ITEMDELETE_QUALITY,
     CONFIG_ITEMDELETE_ITEM_LEVEL,
     CONFIG_ITEMDELETE_KEEP_DAYS,
+    CONFIG_MAINTENANCE_BATCH_SIZE,
+    CONFIG_MAINTENANCE_BATCH_INTERVAL,
     CONFIG_BG_REWARD_WINNER_HONOR_FIRST,
     CONFIG_BG_REWARD_WINNER_ARENA_FIRST,
     CONFIG_BG_REWARD_WINNER_HONOR_LAST,
@@ -398,6 +408,7 @@ enum ServerConfigs
     CONFIG_RESPAWN_DYNAMICMINIMUM_CREATURE,
     CONFIG_RESPAWN_DYNAMIC_ESCORTNPC,
     CONFIG_RESPAWN_FORCE_COMPATIBILITY_MODE,
+    CONFIG_RESPAWN_SAVE_INTERVAL,
     RATE_HEALTH,
     RATE_POWER_MANA,
     RATE_POWER_RAGE_INCOME,
@@ -535,45 +535,25 @@ public:
             return true;
         }
 
-        // Fallback to DB query
-        WorldDatabasePreparedStatement* stmt = WorldDatabase.GetPreparedStatement(WORLD_SEL_GAMEOBJECT_NEAREST);
-        stmt->SetData(0, player->GetPositionX());
-        stmt->SetData(1, player->GetPositionY());
-        stmt->SetData(2, player->GetPositionZ());
-        stmt->SetData(3, player->GetMapId());
-        stmt->SetData(4, player->GetPositionX());
-        stmt->SetData(5, player->GetPositionY());
-        stmt->SetData(6, player->GetPositionZ());
-        stmt->SetData(7, distance * distance);
-        stmt->SetData(8, player->GetPhaseMask());
-        PreparedQueryResult result = WorldDatabase.Query(stmt);
-
-        if (result)
-        {
-            do
-            {
-                Field* fields = result->Fetch();
-                ObjectGuid::LowType guid = fields[0].Get<uint32>();
-
-                // Skip entries already emitted via grid search
-                if (gridSpawnIds.count(guid))
-                    continue;
+        // Fallback to the spawn index for spawns in unloaded cells
+        SpawnSpatialIndex::SpawnList spawns;
+        sObjectMgr->GetSpawnSpatialIndex().GetSpawnsInRange(spawns, player->GetMapId(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ(), distance, SPAWN_TYPEMASK_GAMEOBJECT);
 
-                uint32 entry = fields[1].Get<uint32>();
-                float x = fields[2].Get<float>();
-                float y = fields[3].Get<float>();
-                float z = fields[4].Get<float>();
-                uint16 mapId = fields[5].Get<uint16>();
-
-                GameObjectTemplate const* gameObjectInfo = sObjectMgr->GetGameObjectTemplate(entry);
+        for (SpawnData const* spawn : spawns)
+        {
+            // Skip entries already emitted via grid search
+            if (!(spawn->phaseMask & player->GetPhaseMask()) || gridSpawnIds.count(spawn->spawnId))
+                continue;
 
-                if (!gameObjectInfo)
-                    continue;
+            GameObjectData const* data = static_cast<GameObjectData const*>(spawn);
+            GameObjectTemplate const* gameObjectInfo = sObjectMgr->GetGameObjectTemplate(data->id);
+            if (!gameObjectInfo)
+                continue;
 
-                handler->PSendSysMessage(LANG_GO_LIST_CHAT, guid, entry, guid, gameObjectInfo->name, x, y, z, mapId, "", "");
+            handler->PSendSysMessage(LANG_GO_LIST_CHAT, data->spawnId, data->id, data->spawnId, gameObjectInfo->name,
+                data->posX, data->posY, data->posZ, data->mapid, "", "");
 
-                ++count;
-            } while (result->NextRow());
+            ++count;
         }
 
         handler->PSendSysMessage(LANG_COMMAND_NEAROBJMESSAGE, distance, count);
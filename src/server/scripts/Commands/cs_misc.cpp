@@ -2807,41 +2807,38 @@ public:
         // Phase 2: force-respawn creatures/GOs that were fully removed (non-compat mode)
         // by setting their respawn times to now so ProcessRespawns() picks them up
         Map* map = player->GetMap();
-        uint32 gridId = Acore::ComputeGridCoord(player->GetPositionX(), player->GetPositionY()).GetId();
+        GridCoord gridCoord = Acore::ComputeGridCoord(player->GetPositionX(), player->GetPositionY());
         time_t now = GameTime::GetGameTime().count();
 
+        // Grid coordinates grow towards negative world coordinates
+        float const maxX = (CENTER_GRID_ID - float(gridCoord.x_coord)) * SIZE_OF_GRIDS;
+        float const maxY = (CENTER_GRID_ID - float(gridCoord.y_coord)) * SIZE_OF_GRIDS;
+
+        SpawnSpatialIndex::SpawnList spawns;
+        sObjectMgr->GetSpawnSpatialIndex().GetSpawnsInBox(spawns, map->GetId(), maxX - SIZE_OF_GRIDS, maxY - SIZE_OF_GRIDS, maxX, maxY);
+
         std::vector<ObjectGuid::LowType> creaturesToRespawn;
-        for (auto const& pair : map->GetCreatureRespawnTimes())
+        std::vector<ObjectGuid::LowType> goesToRespawn;
+        for (SpawnData const* data : spawns)
         {
-            CreatureData const* data = sObjectMgr->GetCreatureData(pair.first);
-            if (!data || Acore::ComputeGridCoord(data->posX, data->posY).GetId() != gridId)
+            if (Acore::ComputeGridCoord(data->posX, data->posY) != gridCoord)
                 continue;
 
             // Skip pooled spawns — Phase 1 already triggered pool rotation via
             // Creature::Respawn() -> PoolMgr::UpdatePool(). Forcing a respawn time
             // here would cause ProcessRespawns() to call UpdatePool() again,
             // spawning duplicates beyond the pool's max_limit.
-            if (sPoolMgr->IsPartOfAPool<Creature>(pair.first))
-                continue;
-
-            creaturesToRespawn.push_back(pair.first);
+            if (data->type == SPAWN_TYPE_CREATURE)
+            {
+                if (map->GetCreatureRespawnTime(data->spawnId) && !sPoolMgr->IsPartOfAPool<Creature>(data->spawnId))
+                    creaturesToRespawn.push_back(data->spawnId);
+            }
+            else if (map->GetGORespawnTime(data->spawnId) && !sPoolMgr->IsPartOfAPool<GameObject>(data->spawnId))
+                goesToRespawn.push_back(data->spawnId);
         }
+
         for (ObjectGuid::LowType spawnId : creaturesToRespawn)
             map->SaveCreatureRespawnTime(spawnId, now);
-
-        std::vector<ObjectGuid::LowType> goesToRespawn;
-        for (auto const& pair : map->GetGORespawnTimes())
-        {
-            GameObjectData const* data = sObjectMgr->GetGameObjectData(pair.first);
-            if (!data || Acore::ComputeGridCoord(data->posX, data->posY).GetId() != gridId)
-                continue;
-
-            // Skip pooled spawns — same reason as creatures above.
-            if (sPoolMgr->IsPartOfAPool<GameObject>(pair.first))
-                continue;
-
-            goesToRespawn.push_back(pair.first);
-        }
         for (ObjectGuid::LowType spawnId : goesToRespawn)
             map->SaveGORespawnTime(spawnId, now);
 
@@ -812,44 +812,25 @@ public:
             return true;
         }
 
-        // Fallback to DB query
-        WorldDatabasePreparedStatement* stmt = WorldDatabase.GetPreparedStatement(WORLD_SEL_CREATURE_NEAREST);
-        stmt->SetData(0, player->GetPositionX());
-        stmt->SetData(1, player->GetPositionY());
-        stmt->SetData(2, player->GetPositionZ());
-        stmt->SetData(3, player->GetMapId());
-        stmt->SetData(4, player->GetPositionX());
-        stmt->SetData(5, player->GetPositionY());
-        stmt->SetData(6, player->GetPositionZ());
-        stmt->SetData(7, distance * distance);
-        stmt->SetData(8, player->GetPhaseMask());
-        PreparedQueryResult result = WorldDatabase.Query(stmt);
-
-        if (result)
-        {
-            do
-            {
-                Field* fields = result->Fetch();
-                ObjectGuid::LowType guid = fields[0].Get<uint32>();
-
-                // Skip entries already emitted via grid search
-                if (gridSpawnIds.count(guid))
-                    continue;
+        // Fallback to the spawn index for spawns in unloaded cells
+        SpawnSpatialIndex::SpawnList spawns;
+        sObjectMgr->GetSpawnSpatialIndex().GetSpawnsInRange(spawns, player->GetMapId(), player->GetPositionX(), player->GetPositionY(), player->GetPositionZ(), distance, SPAWN_TYPEMASK_CREATURE);
 
-                uint32 entry = fields[1].Get<uint32>();
-                float x = fields[2].Get<float>();
-                float y = fields[3].Get<float>();
-                float z = fields[4].Get<float>();
-                uint16 mapId = fields[5].Get<uint16>();
+        for (SpawnData const* spawn : spawns)
+        {
+            // Skip entries already emitted via grid search
+            if (!(spawn->phaseMask & player->GetPhaseMask()) || gridSpawnIds.count(spawn->spawnId))
+                continue;
 
-                CreatureTemplate const* creatureTemplate = sObjectMgr->GetCreatureTemplate(entry);
-                if (!creatureTemplate)
-                    continue;
+            CreatureData const* data = static_cast<CreatureData const*>(spawn);
+            CreatureTemplate const* creatureTemplate = sObjectMgr->GetCreatureTemplate(data->id);
+            if (!creatureTemplate)
+                continue;
 
-                handler->PSendSysMessage(LANG_CREATURE_LIST_CHAT, guid, entry, guid, creatureTemplate->Name, x, y, z, mapId, "", "");
+            handler->PSendSysMessage(LANG_CREATURE_LIST_CHAT, data->spawnId, data->id, data->spawnId, creatureTemplate->Name,
+                data->posX, data->posY, data->posZ, data->mapid, "", "");
 
-                ++count;
-            } while (result->NextRow());
+            ++count;
         }
 
         handler->PSendSysMessage(LANG_COMMAND_NEAR_NPC_MESSAGE, distance, count);
@@ -901,6 +882,7 @@ public:
                 const_cast<CreatureData*>(data)->posY = y;
                 const_cast<CreatureData*>(data)->posZ = z;
                 const_cast<CreatureData*>(data)->orientation = o;
+                sObjectMgr->UpdateSpawnSpatialIndex(data);
             }
 
             creature->SetPosition(x, y, z, o);
@@ -184,6 +184,16 @@ public:
         return commandTable;
     }
 
+    // A background smart_scripts load validates against these tables, they must not change under it
+    static bool CheckNoAsyncReload(ChatHandler* handler)
+    {
+        if (!sWorld->IsAsyncReloadPending())
+            return true;
+
+        handler->SendErrorMessage("A background reload is still running, please attempt reload later.");
+        return false;
+    }
+
     //reload commands
     static bool HandleReloadGMTicketsCommand(ChatHandler* /*handler*/)
     {
@@ -193,6 +203,9 @@ public:
 
     static bool HandleReloadAllCommand(ChatHandler* handler)
     {
+        if (!CheckNoAsyncReload(handler))
+            return false;
+
         HandleReloadSkillFishingBaseLevelCommand(handler);
 
         HandleReloadAllAchievementCommand(handler);
@@ -270,6 +283,9 @@ public:
 
     static bool HandleReloadAllQuestCommand(ChatHandler* handler)
     {
+        if (!CheckNoAsyncReload(handler))
+            return false;
+
         HandleReloadQuestGreetingCommand(handler);
         HandleReloadQuestAreaTriggersCommand(handler);
         HandleReloadQuestPOICommand(handler);
@@ -391,6 +407,9 @@ public:
 
     static bool HandleReloadAreaTriggerCommand(ChatHandler* handler)
     {
+        if (!CheckNoAsyncReload(handler))
+            return false;
+
         LOG_INFO("server.loading", "Reloading Area Trigger definitions...");
         sObjectMgr->LoadAreaTriggers();
         handler->SendGlobalGMSysMessage("DB table `areatrigger` reloaded.");
@@ -460,6 +479,9 @@ public:
         if (args.empty())
             return false;
 
+        if (!CheckNoAsyncReload(handler))
+            return false;
+
         for (std::string_view entryStr : Acore::Tokenize(args, ' ', false))
         {
             uint32 entry = Acore::StringTo<uint32>(entryStr).value_or(0);
@@ -574,6 +596,9 @@ public:
 
     static bool HandleReloadQuestTemplateCommand(ChatHandler* handler)
     {
+        if (!CheckNoAsyncReload(handler))
+            return false;
+
         LOG_INFO("server.loading", "Reloading Quest Templates...");
         sObjectMgr->LoadQuests();
         handler->SendGlobalGMSysMessage("DB table `quest_template` (quest definitions) reloaded.");
@@ -1253,6 +1278,9 @@ public:
 
     static bool HandleReloadCreatureText(ChatHandler* handler)
     {
+        if (!CheckNoAsyncReload(handler))
+            return false;
+
         LOG_INFO("server.loading", "Reloading Creature Texts...");
         sCreatureTextMgr->LoadCreatureTexts();
         handler->SendGlobalGMSysMessage("Creature Texts reloaded.");
@@ -1261,9 +1289,24 @@ public:
 
     static bool HandleReloadSmartScripts(ChatHandler* handler)
     {
-        LOG_INFO("server.loading", "Reloading Smart Scripts...");
-        sSmartScriptMgr->LoadSmartAIFromDB();
-        handler->SendGlobalGMSysMessage("Smart Scripts reloaded.");
+        if (!CheckNoAsyncReload(handler))
+            return false;
+
+        LOG_INFO("server.loading", "Reloading Smart Scripts in the background...");
+        auto spawns = std::make_shared<SmartAISpawnSnapshot>(SmartAIMgr::SnapshotSpawns());
+        sWorld->ReloadAsync("smart_scripts", [spawns]() -> AsyncReloadApplyFunction
+        {
+            uint32 count = 0;
+            auto store = std::make_shared<SmartAIEventStore>(sSmartScriptMgr->LoadSmartAIEventStore(*spawns, count));
+
+            // A failed query also returns no rows, never wipe the live scripts because of it
+            if (!count)
+                throw std::runtime_error("no valid rows loaded from `smart_scripts`");
+
+            sSmartScriptMgr->CheckIfSmartAIInDatabaseExists(*store, *spawns);
+            return [store]() { return sSmartScriptMgr->ApplySmartAIEventStore(std::move(*store)); };
+        });
+        handler->SendSysMessage("Smart Scripts are being reloaded, changes apply once loading finished.");
         return true;
     }
 
@@ -1293,6 +1336,9 @@ public:
 
     static bool HandleReloadSpawnGroupCommand(ChatHandler* handler)
     {
+        if (!CheckNoAsyncReload(handler))
+            return false;
+
         LOG_INFO("server.loading", "Reloading spawn_group_template and spawn_group tables...");
         sObjectMgr->LoadSpawnGroupTemplates();
         sObjectMgr->LoadSpawnGroups();
@@ -20,16 +20,20 @@
 
 #include "Log.h"
 #include "MessageBuffer.h"
+#include <algorithm>
 #include <atomic>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <deque>
 #include <memory>
-#include <queue>
 #include <type_traits>
+#include <vector>
 
 using boost::asio::ip::tcp;
 
 #define READ_BLOCK_SIZE 4096
+// Maximum number of queued buffers handed to a single scatter/gather write (well below IOV_MAX)
+#define WRITE_GATHER_MAX_BUFFERS 64
 #ifdef BOOST_ASIO_HAS_IOCP
 #define AC_SOCKET_USE_IOCP
 #endif
@@ -72,6 +76,7 @@ public:
         _proxyHeaderReadingState(PROXY_HEADER_READING_STATE_NOT_STARTED)
     {
         _readBuffer.Resize(READ_BLOCK_SIZE);
+        _gatherBuffers.reserve(WRITE_GATHER_MAX_BUFFERS);
     }
 
     virtual ~Socket()
@@ -156,9 +161,10 @@ public:
             std::bind(callback, this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
     }
 
+    /// Queued buffers are sent without being copied again, consecutive buffers are gathered into a single write
     void QueuePacket(MessageBuffer&& buffer)
     {
-        _writeQueue.push(std::move(buffer));
+        _writeQueue.push_back(std::move(buffer));
 
 #ifdef AC_SOCKET_USE_IOCP
         AsyncProcessQueue();
@@ -211,8 +217,9 @@ protected:
         _isWritingAsync = true;
 
 #ifdef AC_SOCKET_USE_IOCP
-        MessageBuffer& buffer = _writeQueue.front();
-        _socket.async_write_some(boost::asio::buffer(buffer.GetReadPointer(), buffer.GetActiveSize()), std::bind(&Socket<T>::WriteHandler,
+        // _gatherBuffers is left untouched until WriteHandler runs, only one write is in flight at a time
+        GatherWriteQueue();
+        _socket.async_write_some(_gatherBuffers, std::bind(&Socket<T>::WriteHandler,
             this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
 #else
         _socket.async_wait(boost::asio::socket_base::wait_write, [self = this->shared_from_this()](boost::system::error_code error)
@@ -234,6 +241,44 @@ protected:
     }
 
 private:
+    /// Collects the front of the write queue into _gatherBuffers, returns the total amount of bytes gathered
+    std::size_t GatherWriteQueue()
+    {
+        _gatherBuffers.clear();
+
+        std::size_t totalBytes = 0;
+        for (MessageBuffer& buffer : _writeQueue)
+        {
+            if (_gatherBuffers.size() >= WRITE_GATHER_MAX_BUFFERS)
+                break;
+
+            if (!buffer.GetActiveSize())
+                continue;
+
+            _gatherBuffers.emplace_back(buffer.GetReadPointer(), buffer.GetActiveSize());
+            totalBytes += buffer.GetActiveSize();
+        }
+
+        return totalBytes;
+    }
+
+    /// Marks bytes sent by a gathered write as read, dropping every fully sent buffer from the queue
+    void ConsumeWriteQueue(std::size_t bytes)
+    {
+        while (!_writeQueue.empty())
+        {
+            MessageBuffer& buffer = _writeQueue.front();
+            std::size_t const consumed = std::min(bytes, buffer.GetActiveSize());
+            buffer.ReadCompleted(consumed);
+            bytes -= consumed;
+
+            if (buffer.GetActiveSize())
+                break;
+
+            _writeQueue.pop_front();
+        }
+    }
+
     void ReadHandlerInternal(boost::system::error_code error, std::size_t transferredBytes)
     {
         if (error)
@@ -365,10 +410,7 @@ private:
         if (!error)
         {
             _isWritingAsync = false;
-            _writeQueue.front().ReadCompleted(transferedBytes);
-
-            if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+            ConsumeWriteQueue(transferedBytes);
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -392,12 +434,10 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
-
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
+        std::size_t bytesToSend = GatherWriteQueue();
 
         boost::system::error_code error;
-        std::size_t bytesSent = _socket.write_some(boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend), error);
+        std::size_t bytesSent = _socket.write_some(_gatherBuffers, error);
 
         if (error)
         {
@@ -406,7 +446,7 @@ private:
                 return AsyncProcessQueue();
             }
 
-            _writeQueue.pop();
+            _writeQueue.pop_front();
 
             if (_state.load() == SocketState::Closing && _writeQueue.empty())
             {
@@ -417,7 +457,7 @@ private:
         }
         else if (bytesSent == 0)
         {
-            _writeQueue.pop();
+            _writeQueue.pop_front();
 
             if (_state.load() == SocketState::Closing && _writeQueue.empty())
             {
@@ -428,11 +468,11 @@ private:
         }
         else if (bytesSent < bytesToSend) // now n > 0
         {
-            queuedMessage.ReadCompleted(bytesSent);
+            ConsumeWriteQueue(bytesSent);
             return AsyncProcessQueue();
         }
 
-        _writeQueue.pop();
+        ConsumeWriteQueue(bytesSent);
 
         if (_state.load() == SocketState::Closing && _writeQueue.empty())
         {
@@ -449,7 +489,8 @@ private:
     uint16 _remotePort;
 
     MessageBuffer _readBuffer;
-    std::queue<MessageBuffer> _writeQueue;
+    std::deque<MessageBuffer> _writeQueue;
+    std::vector<boost::asio::const_buffer> _gatherBuffers;
 
     std::atomic<SocketState> _state;
 
@@ -119,6 +119,13 @@ public:
         return *this;
     }
 
+    std::vector<uint8>&& Move() noexcept
+    {
+        _rpos = 0;
+        _wpos = 0;
+        return std::move(_storage);
+    }
+
     void clear()
     {
         _storage.clear();
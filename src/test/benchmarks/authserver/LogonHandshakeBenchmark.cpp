@@ -0,0 +1,138 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file LogonHandshakeBenchmark.cpp
+ * @brief Replays the SRP6 steps of a reconnect storm, inline and through AuthCryptoPool
+ *
+ * Every logon runs the two jobs AuthSession hands to the pool: computing B for the
+ * challenge and verifying the client proof. Accounts come from an in-memory table,
+ * no sockets, database or running authserver are involved.
+ */
+
+#include "AuthCryptoPool.h"
+#include "SRP6TestClient.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+
+using namespace SRP6TestClient;
+
+namespace
+{
+    constexpr uint32 ACCOUNTS = 64;
+    constexpr uint32 LOGONS = 4096;
+    constexpr uint32 ADDRESSES = 256;
+
+    struct Logon
+    {
+        AccountRow const* Account;
+        std::unique_ptr<SRP6> Server;
+        ClientProof Proof;
+        bool Verified = false;
+    };
+
+    // Client side of each handshake is prepared up front, only the server work is timed
+    std::vector<Logon> PrepareLogons(std::vector<AccountRow> const& accounts)
+    {
+        std::vector<Logon> logons(LOGONS);
+        for (uint32 i = 0; i < LOGONS; ++i)
+            logons[i].Account = &accounts[i % ACCOUNTS];
+
+        return logons;
+    }
+
+    void Challenge(Logon& logon)
+    {
+        logon.Server = std::make_unique<SRP6>(logon.Account->Login, logon.Account->Salt, logon.Account->Verifier);
+    }
+
+    void Proof(Logon& logon)
+    {
+        logon.Verified = logon.Server->VerifyChallengeResponse(logon.Proof.A, logon.Proof.M).has_value();
+    }
+
+    double Seconds(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+TEST(LogonHandshakeBenchmark, ChallengeAndProofThroughput)
+{
+    std::vector<AccountRow> const accounts = MakeAccountTable(ACCOUNTS);
+
+    // LoginCrypto.WorkerThreads = 0, both steps on the network thread
+    std::vector<Logon> logons = PrepareLogons(accounts);
+    double inlineSeconds = 0.0;
+    for (Logon& logon : logons)
+    {
+        auto start = std::chrono::steady_clock::now();
+        Challenge(logon);
+        inlineSeconds += Seconds(start);
+
+        logon.Proof = MakeClientProof(*logon.Account, logon.Server->B);
+
+        start = std::chrono::steady_clock::now();
+        Proof(logon);
+        inlineSeconds += Seconds(start);
+    }
+
+    for (Logon const& logon : logons)
+        ASSERT_TRUE(logon.Verified);
+
+    uint32 const threads = std::max(2u, std::thread::hardware_concurrency());
+    sAuthCryptoPool->Start(threads, LOGONS, LOGONS / ADDRESSES);
+
+    auto runPooled = [](std::vector<Logon>& batch, void (*step)(Logon&))
+    {
+        std::atomic<uint32> remaining = LOGONS;
+        std::promise<void> done;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < LOGONS; ++i)
+        {
+            Logon& logon = batch[i];
+            bool queued = sAuthCryptoPool->Enqueue(boost::asio::ip::make_address_v4(0x0A000000 + i % ADDRESSES), [&logon, step, &remaining, &done]()
+            {
+                step(logon);
+                if (!--remaining)
+                    done.set_value();
+            });
+
+            EXPECT_TRUE(queued);
+        }
+
+        done.get_future().wait();
+        return Seconds(start);
+    };
+
+    logons = PrepareLogons(accounts);
+    double pooledSeconds = runPooled(logons, &Challenge);
+    for (Logon& logon : logons)
+        logon.Proof = MakeClientProof(*logon.Account, logon.Server->B);
+
+    pooledSeconds += runPooled(logons, &Proof);
+    sAuthCryptoPool->Stop();
+
+    for (Logon const& logon : logons)
+        ASSERT_TRUE(logon.Verified);
+
+    std::cout << "[  INFO    ] " << LOGONS << " handshakes from " << ADDRESSES << " addresses" << std::endl;
+    std::cout << "[  INFO    ] inline: " << uint32(LOGONS / inlineSeconds) << " handshakes/s" << std::endl;
+    std::cout << "[  INFO    ] " << threads << " pool thread(s): " << uint32(LOGONS / pooledSeconds) << " handshakes/s" << std::endl;
+}
@@ -0,0 +1,78 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ConditionTestFixture.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <iostream>
+#include <unordered_map>
+
+using ConditionEvaluationBenchmark = ConditionTestFixture;
+
+// Times a gossip-like lookup and check: the previous path copied the list out of a
+// std::map and walked it with a std::map of else groups and reference lookups,
+// the current one binds the stored vector and follows pre-resolved references
+TEST_F(ConditionEvaluationBenchmark, AgainstPreviousInterpreter)
+{
+    constexpr uint32 ENTRIES = 1024;
+    constexpr uint32 CHECKS = 1000000;
+
+    uint32 const mapId = _creature->GetMapId();
+    AddReference(1, { Make(CONDITION_TYPE_MASK, TYPEMASK_PLAYER, 0, 0) });
+    AddReference(2, { Make(CONDITION_ALIVE, 0, 0, 0), Make(CONDITION_LEVEL, 80, COMP_TYPE_EQ, 0) });
+
+    std::unordered_map<uint32, ConditionList> store;
+    std::map<uint32, LegacyConditionList> legacyStore;
+    for (uint32 entry = 0; entry < ENTRIES; ++entry)
+    {
+        ConditionList conditions = { Make(CONDITION_LEVEL, 81, COMP_TYPE_HIGH_EQ, 0), MakeReference(1, 0),
+            MakeReference(2, 1), Make(CONDITION_MAPID, mapId, 0, 1), Make(CONDITION_ALIVE, 0, 0, 2, true) };
+
+        legacyStore[entry] = LegacyConditionList(conditions.begin(), conditions.end());
+        store[entry] = std::move(conditions);
+    }
+
+    using Clock = std::chrono::steady_clock;
+
+    uint32 legacyPassed = 0;
+    Clock::time_point start = Clock::now();
+    for (uint32 i = 0; i < CHECKS; ++i)
+    {
+        LegacyConditionList const conditions = legacyStore[(i * 7919) % ENTRIES];
+        ConditionSourceInfo sourceInfo(_creature);
+        if (LegacyIsObjectMeetToConditionList(sourceInfo, conditions, _legacyReferences))
+            ++legacyPassed;
+    }
+    double const legacySeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    uint32 passed = 0;
+    start = Clock::now();
+    for (uint32 i = 0; i < CHECKS; ++i)
+    {
+        ConditionList const& conditions = store.find((i * 7919) % ENTRIES)->second;
+        ConditionSourceInfo sourceInfo(_creature);
+        if (sConditionMgr->IsObjectMeetToConditions(sourceInfo, conditions))
+            ++passed;
+    }
+    double const currentSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    EXPECT_EQ(passed, CHECKS);
+    EXPECT_EQ(legacyPassed, CHECKS);
+
+    std::cout << "[  INFO    ] Condition checks, previous interpreter: " << uint32(CHECKS / legacySeconds)
+        << "/s, current: " << uint32(CHECKS / currentSeconds) << "/s" << std::endl;
+}
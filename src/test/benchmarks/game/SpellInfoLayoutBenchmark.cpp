@@ -0,0 +1,326 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SpellInfoLayoutBenchmark.cpp
+ * @brief Times the hot field reads of a proc check against the SpellInfo layout
+ *        before and after the hot/cold regrouping
+ *
+ * "Before" mirrors the previous member order and allocates one object per spell the
+ * way LoadSpellInfoStore used to; "after" is the current SpellInfo in one aligned
+ * block. Both read the same fields in the same random spell order. On Linux the L1D
+ * read misses and last level cache misses of each pass are counted as well.
+ */
+
+#include "SpellInfoTestHelper.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <optional>
+#include <random>
+#include <sstream>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr uint32 SPELLS = 32768;
+    constexpr uint32 LOOKUPS = 1 << 22;
+
+    // SpellInfo data members in their order before the regrouping, Effects kept as
+    // opaque storage of the same size
+    struct LegacySpellInfoLayout
+    {
+        uint32 Id;
+        SpellCategoryEntry const* CategoryEntry;
+        uint32 Dispel;
+        uint32 Mechanic;
+        uint32 Attributes;
+        uint32 AttributesEx;
+        uint32 AttributesEx2;
+        uint32 AttributesEx3;
+        uint32 AttributesEx4;
+        uint32 AttributesEx5;
+        uint32 AttributesEx6;
+        uint32 AttributesEx7;
+        uint32 AttributesCu;
+        uint32 Stances;
+        uint32 StancesNot;
+        uint32 Targets;
+        uint32 TargetCreatureType;
+        uint32 RequiresSpellFocus;
+        uint32 FacingCasterFlags;
+        uint32 CasterAuraState;
+        uint32 TargetAuraState;
+        uint32 CasterAuraStateNot;
+        uint32 TargetAuraStateNot;
+        uint32 CasterAuraSpell;
+        uint32 TargetAuraSpell;
+        uint32 ExcludeCasterAuraSpell;
+        uint32 ExcludeTargetAuraSpell;
+        SpellCastTimesEntry const* CastTimeEntry;
+        uint32 RecoveryTime;
+        uint32 CategoryRecoveryTime;
+        uint32 StartRecoveryCategory;
+        uint32 StartRecoveryTime;
+        uint32 InterruptFlags;
+        uint32 AuraInterruptFlags;
+        uint32 ChannelInterruptFlags;
+        uint32 ProcFlags;
+        uint32 ProcChance;
+        uint32 ProcCharges;
+        uint32 MaxLevel;
+        uint32 BaseLevel;
+        uint32 SpellLevel;
+        SpellDurationEntry const* DurationEntry;
+        uint32 PowerType;
+        uint32 ManaCost;
+        uint32 ManaCostPerlevel;
+        uint32 ManaPerSecond;
+        uint32 ManaPerSecondPerLevel;
+        uint32 ManaCostPercentage;
+        uint32 RuneCostID;
+        SpellRangeEntry const* RangeEntry;
+        float  Speed;
+        uint32 StackAmount;
+        std::array<uint32, 2> Totem;
+        std::array<int32, MAX_SPELL_REAGENTS>  Reagent;
+        std::array<uint32, MAX_SPELL_REAGENTS> ReagentCount;
+        int32  EquippedItemClass;
+        int32  EquippedItemSubClassMask;
+        int32  EquippedItemInventoryTypeMask;
+        std::array<uint32, 2> TotemCategory;
+        std::array<uint32, 2> SpellVisual;
+        uint32 SpellIconID;
+        uint32 ActiveIconID;
+        uint32 SpellPriority;
+        std::array<char const*, 16> SpellName;
+        std::array<char const*, 16> Rank;
+        uint32 MaxTargetLevel;
+        uint32 MaxAffectedTargets;
+        uint32 SpellFamilyName;
+        flag96 SpellFamilyFlags;
+        uint32 DmgClass;
+        uint32 PreventionType;
+        int32  AreaGroupId;
+        uint32 SchoolMask;
+        alignas(SpellEffectInfo) std::byte Effects[sizeof(std::array<SpellEffectInfo, MAX_SPELL_EFFECTS>)];
+        uint32 ExplicitTargetMask;
+        SpellChainNode const* ChainEntry;
+
+        AuraStateType _auraState;
+        SpellSpecificType _spellSpecific;
+        bool _isStackableWithRanks;
+        bool _isSpellValid;
+        bool _isCritCapable;
+        bool _requireCooldownInfo;
+        float JumpDistance;
+    };
+
+    // The fields a proc check reads before it gets to the effects
+    template<typename Info>
+    uint64 ReadProcFields(Info const& info)
+    {
+        uint64 sum = info.Attributes + info.AttributesEx3 + info.AttributesCu + info.SchoolMask + info.DmgClass;
+        sum += info.SpellFamilyName + info.SpellFamilyFlags[0] + info.ProcFlags + info.ProcChance + info.Mechanic;
+        sum += info.InterruptFlags + info.StackAmount + (info.RangeEntry != nullptr);
+        return sum;
+    }
+
+    // Counts one hardware cache event of the calling thread, when the kernel allows it
+    class CacheEventCounter
+    {
+    public:
+        CacheEventCounter(uint32 type, uint64 config)
+        {
+#if defined(__linux__)
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = type;
+            attr.config = config;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            _fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#else
+            (void)type;
+            (void)config;
+#endif
+        }
+
+        ~CacheEventCounter()
+        {
+#if defined(__linux__)
+            if (_fd >= 0)
+                close(_fd);
+#endif
+        }
+
+        CacheEventCounter(CacheEventCounter const&) = delete;
+        CacheEventCounter& operator=(CacheEventCounter const&) = delete;
+
+        void Start()
+        {
+#if defined(__linux__)
+            if (_fd >= 0)
+            {
+                ioctl(_fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+#endif
+        }
+
+        std::optional<uint64> Stop()
+        {
+#if defined(__linux__)
+            uint64 count = 0;
+            if (_fd >= 0 && ioctl(_fd, PERF_EVENT_IOC_DISABLE, 0) == 0 && read(_fd, &count, sizeof(count)) == sizeof(count))
+                return count;
+#endif
+            return std::nullopt;
+        }
+
+    private:
+        int _fd = -1;
+    };
+
+    struct PassResult
+    {
+        uint64 Sum = 0;
+        double NsPerLookup = 0.0;
+        std::optional<uint64> L1DMisses;
+        std::optional<uint64> LLCMisses;
+    };
+
+    template<typename Info>
+    PassResult RunPass(std::vector<Info const*> const& store, std::vector<uint32> const& order)
+    {
+#if defined(__linux__)
+        CacheEventCounter l1d(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+        CacheEventCounter llc(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+#else
+        CacheEventCounter l1d(0, 0);
+        CacheEventCounter llc(0, 0);
+#endif
+
+        PassResult result;
+        l1d.Start();
+        llc.Start();
+        std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+        for (uint32 index : order)
+            result.Sum += ReadProcFields(*store[index]);
+
+        double const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        result.LLCMisses = llc.Stop();
+        result.L1DMisses = l1d.Stop();
+        result.NsPerLookup = seconds * 1e9 / order.size();
+        return result;
+    }
+
+    void Print(char const* name, PassResult const& result)
+    {
+        auto perLookup = [](std::optional<uint64> count) -> std::string
+        {
+            if (!count)
+                return "n/a";
+
+            std::ostringstream out;
+            out << std::fixed << std::setprecision(2) << double(*count) / LOOKUPS;
+            return out.str();
+        };
+
+        std::cout << "[  INFO    ] " << name << ": " << std::fixed << std::setprecision(1) << result.NsPerLookup
+            << " ns/lookup, L1D read misses/lookup " << perLookup(result.L1DMisses)
+            << ", LLC misses/lookup " << perLookup(result.LLCMisses) << std::endl;
+    }
+}
+
+TEST(SpellInfoLayoutBenchmark, ProcFieldReadsBeforeAndAfterRegrouping)
+{
+    // After: every SpellInfo in one cache line aligned block, as SpellMgr::LoadSpellInfoStore builds it
+    void* storage = ::operator new(SPELLS * sizeof(SpellInfo), std::align_val_t(alignof(SpellInfo)));
+    std::vector<SpellInfo const*> current(SPELLS);
+    // Before: one heap allocation per spell in id order, as LoadSpellInfoStore did it
+    std::vector<LegacySpellInfoLayout const*> legacy(SPELLS);
+
+    SpellInfo* slot = static_cast<SpellInfo*>(storage);
+    for (uint32 i = 0; i < SPELLS; ++i)
+    {
+        TestSpellEntryHelper entry;
+        entry.WithId(i + 1)
+            .WithAttributes(i)
+            .WithProcFlags(i & 0xFF)
+            .WithSchoolMask(1 << (i % 7))
+            .WithSpellFamilyName(i % 18)
+            .WithDmgClass(i % 4);
+        SpellInfo const* info = new (slot++) SpellInfo(entry.Get());
+        current[i] = info;
+
+        LegacySpellInfoLayout* old = new LegacySpellInfoLayout{};
+        old->Id = info->Id;
+        old->Attributes = info->Attributes;
+        old->AttributesEx3 = info->AttributesEx3;
+        old->AttributesCu = info->AttributesCu;
+        old->SchoolMask = info->SchoolMask;
+        old->DmgClass = info->DmgClass;
+        old->SpellFamilyName = info->SpellFamilyName;
+        old->SpellFamilyFlags = info->SpellFamilyFlags;
+        old->ProcFlags = info->ProcFlags;
+        old->ProcChance = info->ProcChance;
+        old->Mechanic = info->Mechanic;
+        old->InterruptFlags = info->InterruptFlags;
+        old->StackAmount = info->StackAmount;
+        old->RangeEntry = info->RangeEntry;
+        legacy[i] = old;
+    }
+
+    std::vector<uint32> order(LOOKUPS);
+    std::mt19937 rng(30);
+    std::uniform_int_distribution<uint32> dist(0, SPELLS - 1);
+    for (uint32& index : order)
+        index = dist(rng);
+
+    // Warm up the page tables of both stores before timing either
+    RunPass(legacy, order);
+    RunPass(current, order);
+
+    PassResult const before = RunPass(legacy, order);
+    PassResult const after = RunPass(current, order);
+
+    EXPECT_EQ(before.Sum, after.Sum);
+
+    std::cout << "[  INFO    ] " << SPELLS << " spells, " << LOOKUPS << " random lookups, sizeof(SpellInfo) "
+        << sizeof(SpellInfo) << ", previous layout " << sizeof(LegacySpellInfoLayout) << std::endl;
+    Print("before", before);
+    Print("after ", after);
+
+    for (LegacySpellInfoLayout const* old : legacy)
+        delete old;
+
+    for (SpellInfo const* info : current)
+        info->~SpellInfo();
+
+    ::operator delete(storage, std::align_val_t(alignof(SpellInfo)));
+}
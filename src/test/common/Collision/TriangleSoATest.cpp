@@ -0,0 +1,169 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldModel.h"
+#include "gtest/gtest.h"
+#include <G3D/Ray.h>
+#include <random>
+
+using namespace VMAP;
+
+namespace
+{
+    struct TestMesh
+    {
+        std::vector<G3D::Vector3> Vertices;
+        std::vector<MeshTriangle> Triangles;
+    };
+
+    TestMesh MakeRandomMesh(std::mt19937& rng, uint32 triangleCount)
+    {
+        std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+        std::uniform_real_distribution<float> offset(-5.0f, 5.0f);
+
+        TestMesh mesh;
+        for (uint32 i = 0; i < triangleCount; ++i)
+        {
+            G3D::Vector3 center(position(rng), position(rng), position(rng));
+            for (uint32 j = 0; j < 3; ++j)
+                mesh.Vertices.emplace_back(center.x + offset(rng), center.y + offset(rng), center.z + offset(rng));
+
+            mesh.Triangles.emplace_back(i * 3, i * 3 + 1, i * 3 + 2);
+        }
+
+        return mesh;
+    }
+
+    G3D::Ray MakeRandomRay(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+        G3D::Vector3 origin(position(rng), position(rng), position(rng));
+        G3D::Vector3 target(position(rng), position(rng), position(rng));
+        return G3D::Ray::fromOriginAndDirection(origin, (target - origin).direction());
+    }
+
+    // plain one triangle at a time Moller-Trumbore, independent of TriangleSoA
+    bool ReferenceIntersect(TestMesh const& mesh, G3D::Ray const& ray, float& distance)
+    {
+        bool hit = false;
+        for (MeshTriangle const& tri : mesh.Triangles)
+        {
+            G3D::Vector3 const e1 = mesh.Vertices[tri.idx1] - mesh.Vertices[tri.idx0];
+            G3D::Vector3 const e2 = mesh.Vertices[tri.idx2] - mesh.Vertices[tri.idx0];
+            G3D::Vector3 const p(ray.direction().cross(e2));
+            float const a = e1.dot(p);
+            if (std::fabs(a) < 1e-5f)
+                continue;
+
+            float const f = 1.0f / a;
+            G3D::Vector3 const s(ray.origin() - mesh.Vertices[tri.idx0]);
+            float const u = f * s.dot(p);
+            if (u < 0.0f || u > 1.0f)
+                continue;
+
+            G3D::Vector3 const q(s.cross(e1));
+            float const v = f * ray.direction().dot(q);
+            if (v < 0.0f || (u + v) > 1.0f)
+                continue;
+
+            float const t = f * e2.dot(q);
+            if (t > 0.0f && t < distance)
+            {
+                distance = t;
+                hit = true;
+            }
+        }
+
+        return hit;
+    }
+}
+
+TEST(TriangleSoATest, VectorPathMatchesScalarPath)
+{
+    std::mt19937 rng(1234);
+    TestMesh mesh = MakeRandomMesh(rng, 257);
+
+    BIH tree;
+    std::vector<G3D::Vector3> vertices = mesh.Vertices;
+    std::vector<MeshTriangle> triangles = mesh.Triangles;
+    auto bounds = [&](MeshTriangle const& tri, G3D::AABox& out)
+    {
+        G3D::Vector3 lo = vertices[tri.idx0].min(vertices[tri.idx1]).min(vertices[tri.idx2]);
+        G3D::Vector3 hi = vertices[tri.idx0].max(vertices[tri.idx1]).max(vertices[tri.idx2]);
+        out = G3D::AABox(lo, hi);
+    };
+    tree.build(triangles, bounds);
+
+    TriangleSoA soa;
+    soa.build(vertices, triangles, tree);
+    ASSERT_EQ(soa.size(), triangles.size());
+
+    std::uniform_int_distribution<uint32> slot(0, soa.size() - 1);
+    for (uint32 i = 0; i < 2000; ++i)
+    {
+        G3D::Ray ray = MakeRandomRay(rng);
+        uint32 first = slot(rng);
+        uint32 count = std::min<uint32>(1 + i % 9, soa.size() - first);
+
+        float vectorDistance = G3D::finf();
+        float scalarDistance = G3D::finf();
+        bool vectorHit = soa.intersectRay(ray, first, count, vectorDistance);
+        bool scalarHit = soa.intersectRayScalar(ray, first, count, scalarDistance);
+
+        ASSERT_EQ(vectorHit, scalarHit);
+        if (scalarHit)
+        {
+            ASSERT_FLOAT_EQ(vectorDistance, scalarDistance);
+        }
+    }
+}
+
+TEST(TriangleSoATest, GroupModelMatchesBruteForce)
+{
+    std::mt19937 rng(4321);
+    TestMesh mesh = MakeRandomMesh(rng, 500);
+
+    GroupModel model(0, 0, G3D::AABox(G3D::Vector3(-60.0f, -60.0f, -60.0f), G3D::Vector3(60.0f, 60.0f, 60.0f)));
+    std::vector<G3D::Vector3> vertices = mesh.Vertices;
+    std::vector<MeshTriangle> triangles = mesh.Triangles;
+    model.setMeshData(vertices, triangles);
+
+    uint32 hits = 0;
+    for (uint32 i = 0; i < 2000; ++i)
+    {
+        G3D::Ray ray = MakeRandomRay(rng);
+
+        float expectedDistance = G3D::finf();
+        bool expectedHit = ReferenceIntersect(mesh, ray, expectedDistance);
+
+        float distance = G3D::finf();
+        bool hit = model.IntersectRay(ray, distance, false);
+
+        ASSERT_EQ(hit, expectedHit);
+        if (expectedHit)
+        {
+            ASSERT_FLOAT_EQ(distance, expectedDistance);
+            ++hits;
+        }
+
+        // any hit is enough when stopping early, but it has to agree on whether there is one
+        float firstDistance = G3D::finf();
+        ASSERT_EQ(model.IntersectRay(ray, firstDistance, true), expectedHit);
+    }
+
+    EXPECT_GT(hits, 0u);
+}
@@ -0,0 +1,121 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AZEROTHCORE_CONDITION_TEST_FIXTURE_H
+#define AZEROTHCORE_CONDITION_TEST_FIXTURE_H
+
+#include "ConditionMgr.h"
+#include "IntegrationTestFixture.h"
+#include "gtest/gtest.h"
+#include <list>
+#include <map>
+#include <memory>
+
+using LegacyConditionList = std::list<Condition*>;
+using LegacyReferenceStore = std::map<uint32, LegacyConditionList>;
+
+// The evaluation ConditionMgr did before lists became vectors with pre-resolved
+// references: a std::map of else groups per call and a reference store lookup
+inline bool LegacyIsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, LegacyConditionList const& conditions, LegacyReferenceStore const& references)
+{
+    std::map<uint32, bool> elseGroupStore;
+    for (Condition* condition : conditions)
+    {
+        if (!condition->isLoaded())
+            continue;
+
+        auto itr = elseGroupStore.find(condition->ElseGroup);
+        if (itr == elseGroupStore.end())
+            elseGroupStore[condition->ElseGroup] = true;
+        else if (!itr->second)
+            continue;
+
+        if (condition->ReferenceId)
+        {
+            auto ref = references.find(condition->ReferenceId);
+            if (ref != references.end() && !LegacyIsObjectMeetToConditionList(sourceInfo, ref->second, references))
+                elseGroupStore[condition->ElseGroup] = false;
+        }
+        else if (!condition->Meets(sourceInfo))
+            elseGroupStore[condition->ElseGroup] = false;
+    }
+
+    for (auto const& [elseGroup, passed] : elseGroupStore)
+        if (passed)
+            return true;
+
+    return false;
+}
+
+/**
+ * @brief Builds conditions and reference templates against one test creature
+ *
+ * Every reference is registered both pre-resolved, as ConditionMgr stores it now,
+ * and in a LegacyReferenceStore for LegacyIsObjectMeetToConditionList.
+ */
+class ConditionTestFixture : public IntegrationTestFixture
+{
+protected:
+    void SetUp() override
+    {
+        IntegrationTestFixture::SetUp();
+        _creature = CreateTestCreature(1, 12345, TEST_FACTION_HOSTILE_TO_ALL);
+    }
+
+    Condition* Make(ConditionTypes type, uint32 value1, uint32 value2, uint32 elseGroup, bool negative = false)
+    {
+        Condition* condition = _conditions.emplace_back(std::make_unique<Condition>()).get();
+        condition->ConditionType = type;
+        condition->ConditionValue1 = value1;
+        condition->ConditionValue2 = value2;
+        condition->ElseGroup = elseGroup;
+        condition->NegativeCondition = negative;
+        return condition;
+    }
+
+    // Reference templates are kept in both stores, the legacy one is searched on every use
+    void AddReference(uint32 referenceId, ConditionList const& conditions)
+    {
+        _references[referenceId] = conditions;
+        _legacyReferences[referenceId] = LegacyConditionList(conditions.begin(), conditions.end());
+    }
+
+    Condition* MakeReference(uint32 referenceId, uint32 elseGroup)
+    {
+        Condition* condition = Make(CONDITION_NONE, 0, 0, elseGroup);
+        condition->ReferenceId = referenceId;
+        condition->ReferenceConditions = &_references.at(referenceId);
+        return condition;
+    }
+
+    void ExpectSameResult(ConditionList const& conditions, bool expected)
+    {
+        ConditionSourceInfo current(_creature);
+        ConditionSourceInfo legacy(_creature);
+        LegacyConditionList const legacyConditions(conditions.begin(), conditions.end());
+
+        EXPECT_EQ(sConditionMgr->IsObjectMeetToConditions(current, conditions), expected);
+        EXPECT_EQ(LegacyIsObjectMeetToConditionList(legacy, legacyConditions, _legacyReferences), expected);
+    }
+
+    TestCreature* _creature = nullptr;
+    std::vector<std::unique_ptr<Condition>> _conditions;
+    std::map<uint32, ConditionList> _references;
+    LegacyReferenceStore _legacyReferences;
+};
+
+#endif //AZEROTHCORE_CONDITION_TEST_FIXTURE_H
@@ -0,0 +1,124 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AZEROTHCORE_SRP6_TEST_CLIENT_H
+#define AZEROTHCORE_SRP6_TEST_CLIENT_H
+
+#include "SRP6.h"
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Client side of the SRP6 logon handshake and an in-memory account table
+ *
+ * Used to drive the authserver's SRP6 steps without a database or a game client.
+ */
+namespace SRP6TestClient
+{
+    using SRP6 = Acore::Crypto::SRP6;
+    using SHA1 = Acore::Crypto::SHA1;
+
+    struct AccountRow
+    {
+        std::string Login;
+        SRP6::Salt Salt;
+        SRP6::Verifier Verifier;
+    };
+
+    // Stand-in for the `account` table, what LogonChallengeCallback reads
+    inline std::vector<AccountRow> MakeAccountTable(uint32 count)
+    {
+        std::vector<AccountRow> accounts;
+        accounts.reserve(count);
+        for (uint32 i = 0; i < count; ++i)
+        {
+            std::string login = "ACCOUNT" + std::to_string(i);
+            auto [salt, verifier] = SRP6::MakeRegistrationData(login, "PASSWORD");
+            accounts.push_back({ std::move(login), salt, verifier });
+        }
+
+        return accounts;
+    }
+
+    inline SessionKey Interleave(SRP6::EphemeralKey const& S)
+    {
+        std::array<uint8, SRP6::EPHEMERAL_KEY_LENGTH / 2> buf0{}, buf1{};
+        for (std::size_t i = 0; i < SRP6::EPHEMERAL_KEY_LENGTH / 2; ++i)
+        {
+            buf0[i] = S[2 * i + 0];
+            buf1[i] = S[2 * i + 1];
+        }
+
+        std::size_t p = 0;
+        while (p < SRP6::EPHEMERAL_KEY_LENGTH && !S[p])
+            ++p;
+
+        if (p & 1)
+            ++p;
+
+        p /= 2;
+
+        SHA1::Digest const hash0 = SHA1::GetDigestOf(buf0.data() + p, SRP6::EPHEMERAL_KEY_LENGTH / 2 - p);
+        SHA1::Digest const hash1 = SHA1::GetDigestOf(buf1.data() + p, SRP6::EPHEMERAL_KEY_LENGTH / 2 - p);
+
+        SessionKey K;
+        for (std::size_t i = 0; i < SHA1::DIGEST_LENGTH; ++i)
+        {
+            K[2 * i + 0] = hash0[i];
+            K[2 * i + 1] = hash1[i];
+        }
+
+        return K;
+    }
+
+    struct ClientProof
+    {
+        SRP6::EphemeralKey A;
+        SHA1::Digest M;
+    };
+
+    // Client half of the handshake, answers the server's B the way the game client does
+    inline ClientProof MakeClientProof(AccountRow const& account, SRP6::EphemeralKey const& B)
+    {
+        BigNumber const N(SRP6::N);
+        BigNumber const g(SRP6::g);
+
+        BigNumber const x(SHA1::GetDigestOf(account.Salt, SHA1::GetDigestOf(account.Login, ":", "PASSWORD")));
+        BigNumber a;
+        a.SetRand(19 * 8);
+
+        ClientProof proof;
+        proof.A = g.ModExp(a, N).ToByteArray<32>();
+
+        BigNumber const u(SHA1::GetDigestOf(proof.A, B));
+        BigNumber const base = (BigNumber(B) + N - (g.ModExp(x, N) * 3) % N) % N;
+        SessionKey const K = Interleave(base.ModExp(a + u * x, N).ToByteArray<32>());
+
+        SHA1::Digest const NHash = SHA1::GetDigestOf(SRP6::N);
+        SHA1::Digest const gHash = SHA1::GetDigestOf(SRP6::g);
+        SHA1::Digest NgHash;
+        std::transform(NHash.begin(), NHash.end(), gHash.begin(), NgHash.begin(), std::bit_xor<>());
+
+        proof.M = SHA1::GetDigestOf(NgHash, SHA1::GetDigestOf(account.Login), account.Salt, proof.A, B, K);
+        return proof;
+    }
+}
+
+#endif // AZEROTHCORE_SRP6_TEST_CLIENT_H
@@ -86,6 +86,8 @@ public:
     MOCK_METHOD(void, SetRealmName, (std::string name), ());
     MOCK_METHOD(void, RemoveOldCorpses, ());
     MOCK_METHOD(void, ReloadRBAC, ());
+    MOCK_METHOD(void, ReloadAsync, (std::string const& tableName, std::function<AsyncReloadApplyFunction()>&& loader), ());
+    MOCK_METHOD(bool, IsAsyncReloadPending, (), (const));
 };
 #pragma GCC diagnostic pop
 
@@ -0,0 +1,152 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuthCryptoPool.h"
+#include "SRP6TestClient.h"
+#include "gtest/gtest.h"
+#include <atomic>
+
+using namespace SRP6TestClient;
+
+namespace
+{
+    boost::asio::ip::address MakeAddress(uint32 index)
+    {
+        return boost::asio::ip::make_address_v4(0x7F000001 + index);
+    }
+
+    class AuthCryptoPoolTest : public ::testing::Test
+    {
+    protected:
+        void TearDown() override
+        {
+            sAuthCryptoPool->Stop();
+        }
+    };
+}
+
+TEST_F(AuthCryptoPoolTest, HandshakeVerifiesAgainstAccountTable)
+{
+    std::vector<AccountRow> const accounts = MakeAccountTable(4);
+    for (AccountRow const& account : accounts)
+    {
+        SRP6 server(account.Login, account.Salt, account.Verifier);
+        ClientProof const proof = MakeClientProof(account, server.B);
+        EXPECT_TRUE(server.VerifyChallengeResponse(proof.A, proof.M).has_value()) << account.Login;
+    }
+
+    SRP6 server(accounts[0].Login, accounts[0].Salt, accounts[0].Verifier);
+    ClientProof proof = MakeClientProof(accounts[0], server.B);
+    proof.M[0] ^= 0xFF;
+    EXPECT_FALSE(server.VerifyChallengeResponse(proof.A, proof.M).has_value());
+}
+
+TEST_F(AuthCryptoPoolTest, AddressesAreServedRoundRobin)
+{
+    sAuthCryptoPool->Start(1, 0, 0);
+
+    std::promise<void> started;
+    std::promise<void> gate;
+    std::shared_future<void> gateFuture = gate.get_future().share();
+    ASSERT_TRUE(sAuthCryptoPool->Enqueue(MakeAddress(0), [&started, gateFuture]() { started.set_value(); gateFuture.wait(); }));
+    started.get_future().wait();
+
+    std::mutex orderLock;
+    std::vector<std::string> order;
+    std::promise<void> done;
+    std::atomic<uint32> remaining = 5;
+    auto job = [&](std::string name)
+    {
+        return [&, name]()
+        {
+            {
+                std::lock_guard<std::mutex> guard(orderLock);
+                order.push_back(name);
+            }
+
+            if (!--remaining)
+                done.set_value();
+        };
+    };
+
+    // A reconnect flood from one address queued ahead of a single login from another
+    for (std::string name : { "A1", "A2", "A3", "A4" })
+        ASSERT_TRUE(sAuthCryptoPool->Enqueue(MakeAddress(0), job(name)));
+
+    ASSERT_TRUE(sAuthCryptoPool->Enqueue(MakeAddress(1), job("B1")));
+
+    gate.set_value();
+    done.get_future().wait();
+
+    std::vector<std::string> const expected = { "A1", "B1", "A2", "A3", "A4" };
+    EXPECT_EQ(order, expected);
+}
+
+TEST_F(AuthCryptoPoolTest, RejectsWhenAddressOrQueueIsSaturated)
+{
+    sAuthCryptoPool->Start(1, 3, 2);
+
+    std::promise<void> started;
+    std::promise<void> gate;
+    std::shared_future<void> gateFuture = gate.get_future().share();
+    ASSERT_TRUE(sAuthCryptoPool->Enqueue(MakeAddress(0), [&started, gateFuture]() { started.set_value(); gateFuture.wait(); }));
+    started.get_future().wait();
+
+    // One running and one queued job is the limit of that address
+    EXPECT_TRUE(sAuthCryptoPool->Enqueue(MakeAddress(0), []() { }));
+    EXPECT_FALSE(sAuthCryptoPool->Enqueue(MakeAddress(0), []() { }));
+
+    // Other addresses still get in until the pool wide queue is full
+    EXPECT_TRUE(sAuthCryptoPool->Enqueue(MakeAddress(1), []() { }));
+    EXPECT_TRUE(sAuthCryptoPool->Enqueue(MakeAddress(1), []() { }));
+    EXPECT_EQ(sAuthCryptoPool->GetQueueSize(), 3u);
+    EXPECT_FALSE(sAuthCryptoPool->Enqueue(MakeAddress(2), []() { }));
+
+    gate.set_value();
+}
+
+TEST_F(AuthCryptoPoolTest, StopDropsQueuedJobsAndTheirCallbacks)
+{
+    sAuthCryptoPool->Start(1, 0, 0);
+
+    std::promise<void> started;
+    std::promise<void> gate;
+    std::shared_future<void> gateFuture = gate.get_future().share();
+    ASSERT_TRUE(sAuthCryptoPool->Enqueue(MakeAddress(0), [&started, gateFuture]() { started.set_value(); gateFuture.wait(); }));
+    started.get_future().wait();
+
+    // Queued the way AuthSession::QueueCryptoWork does it
+    bool ran = false;
+    bool called = false;
+    auto task = std::make_shared<std::packaged_task<void()>>([&ran]() { ran = true; });
+    AuthCryptoCallback callback(task->get_future(), [&called]() { called = true; });
+    ASSERT_TRUE(sAuthCryptoPool->Enqueue(MakeAddress(1), [task]() { (*task)(); }));
+    task.reset();
+
+    // Enqueue starts failing once Stop() marked the pool as shutting down, only then the worker is released
+    std::thread stopper([]() { sAuthCryptoPool->Stop(); });
+    while (sAuthCryptoPool->Enqueue(MakeAddress(2), []() { }))
+        std::this_thread::yield();
+
+    gate.set_value();
+    stopper.join();
+
+    EXPECT_FALSE(ran);
+    EXPECT_EQ(sAuthCryptoPool->GetQueueSize(), 0u);
+    EXPECT_TRUE(callback.InvokeIfReady());
+    EXPECT_FALSE(called);
+}
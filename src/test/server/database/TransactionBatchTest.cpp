@@ -0,0 +1,128 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Transaction.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <future>
+#include <thread>
+
+namespace
+{
+    // Counts its destruction, so tests can tell who deleted a queued task
+    class CountingTask : public TransactionTask
+    {
+    public:
+        explicit CountingTask(uint32& destroyed) : TransactionTask(std::make_shared<TransactionBase>()), _destroyed(destroyed) { }
+        ~CountingTask() override { ++_destroyed; }
+
+    private:
+        uint32& _destroyed;
+    };
+}
+
+TEST(TransactionBatchTest, SealHandsOutTasksInQueueOrder)
+{
+    uint32 destroyed = 0;
+    TransactionBatch batch(4);
+    std::vector<TransactionTask*> queued;
+    for (uint32 i = 0; i < 3; ++i)
+    {
+        queued.push_back(new CountingTask(destroyed));
+        ASSERT_TRUE(batch.TryAdd(queued.back()));
+    }
+
+    std::vector<TransactionTask*> sealed = batch.Seal(0ms);
+    EXPECT_EQ(sealed, queued);
+
+    for (TransactionTask* task : sealed)
+        delete task;
+
+    EXPECT_EQ(destroyed, 3u);
+}
+
+TEST(TransactionBatchTest, RefusesTasksOnceFullClosedOrSealed)
+{
+    uint32 destroyed = 0;
+    CountingTask task(destroyed);
+
+    TransactionBatch full(2);
+    EXPECT_TRUE(full.TryAdd(&task));
+    EXPECT_TRUE(full.TryAdd(&task));
+    EXPECT_FALSE(full.TryAdd(&task));
+
+    TransactionBatch closed(2);
+    EXPECT_TRUE(closed.TryAdd(&task));
+    closed.Close();
+    EXPECT_FALSE(closed.TryAdd(&task));
+    EXPECT_EQ(closed.Seal(0ms).size(), 1u);
+
+    TransactionBatch sealed(2);
+    EXPECT_TRUE(sealed.Seal(0ms).empty());
+    EXPECT_FALSE(sealed.TryAdd(&task));
+
+    // A refused task stays with the caller
+    EXPECT_EQ(destroyed, 0u);
+}
+
+TEST(TransactionBatchTest, SealReturnsEarlyWhenFullOrClosed)
+{
+    uint32 destroyed = 0;
+    CountingTask task(destroyed);
+
+    for (bool closeIt : { false, true })
+    {
+        TransactionBatch batch(2);
+        ASSERT_TRUE(batch.TryAdd(&task));
+
+        std::future<std::size_t> sealed = std::async(std::launch::async, [&batch]() { return batch.Seal(1min).size(); });
+        std::this_thread::sleep_for(10ms);
+        if (closeIt)
+            batch.Close();
+        else
+            ASSERT_TRUE(batch.TryAdd(&task));
+
+        ASSERT_EQ(sealed.wait_for(30s), std::future_status::ready) << (closeIt ? "closed" : "full");
+        EXPECT_EQ(sealed.get(), closeIt ? 1u : 2u);
+    }
+}
+
+TEST(TransactionBatchTest, CancelledGroupCommitDeletesQueuedTasks)
+{
+    uint32 destroyed = 0;
+    auto batch = std::make_shared<TransactionBatch>(4);
+    {
+        GroupCommitTask commit(batch, 0ms);
+        ASSERT_TRUE(batch->TryAdd(new CountingTask(destroyed)));
+        ASSERT_TRUE(batch->TryAdd(new CountingTask(destroyed)));
+        EXPECT_EQ(destroyed, 0u);
+    }
+
+    // Never executed, as when the queue is cancelled on shutdown
+    EXPECT_EQ(destroyed, 2u);
+    EXPECT_FALSE(batch->TryAdd(nullptr));
+}
+
+TEST(TransactionBatchTest, EmptyGroupCommitNeedsNoConnection)
+{
+    auto batch = std::make_shared<TransactionBatch>(4);
+    GroupCommitTask commit(batch, 0ms);
+    batch->Close();
+
+    EXPECT_EQ(commit.call(), 0);
+    EXPECT_FALSE(batch->TryAdd(nullptr));
+}
@@ -0,0 +1,49 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ConditionTestFixture.h"
+#include "gtest/gtest.h"
+
+using ConditionEvaluationTest = ConditionTestFixture;
+
+TEST_F(ConditionEvaluationTest, MatchesPreviousInterpreter)
+{
+    uint32 const mapId = _creature->GetMapId();
+
+    ExpectSameResult({ Make(CONDITION_TYPE_MASK, TYPEMASK_UNIT, 0, 0), Make(CONDITION_ALIVE, 0, 0, 0),
+        Make(CONDITION_LEVEL, 70, COMP_TYPE_HIGH_EQ, 0) }, true);
+
+    // First else group fails, second passes
+    ExpectSameResult({ Make(CONDITION_LEVEL, 81, COMP_TYPE_HIGH_EQ, 0), Make(CONDITION_MAPID, mapId, 0, 1) }, true);
+
+    ExpectSameResult({ Make(CONDITION_ALIVE, 0, 0, 0, true), Make(CONDITION_LEVEL, 10, COMP_TYPE_LOW, 1) }, false);
+
+    AddReference(1, { Make(CONDITION_TYPE_MASK, TYPEMASK_PLAYER, 0, 0) });
+    AddReference(2, { Make(CONDITION_ALIVE, 0, 0, 0), Make(CONDITION_LEVEL, 80, COMP_TYPE_EQ, 0) });
+    ExpectSameResult({ MakeReference(1, 0), MakeReference(2, 1) }, true);
+    ExpectSameResult({ MakeReference(1, 0), Make(CONDITION_ALIVE, 0, 0, 0) }, false);
+
+    // More else groups than the on-stack state holds
+    ConditionList manyGroups;
+    for (uint32 elseGroup = 0; elseGroup < 12; ++elseGroup)
+        manyGroups.push_back(Make(CONDITION_MAPID, mapId + 1, 0, elseGroup));
+
+    ExpectSameResult(manyGroups, false);
+
+    manyGroups.push_back(Make(CONDITION_MAPID, mapId, 0, 12));
+    ExpectSameResult(manyGroups, true);
+}
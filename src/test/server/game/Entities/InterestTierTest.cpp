@@ -0,0 +1,117 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "IntegrationTestFixture.h"
+#include "InterestTier.h"
+#include "UpdateData.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    constexpr float NEAR_DISTANCE = 50.0f;
+
+    class InterestTierTest : public IntegrationTestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            IntegrationTestFixture::SetUp();
+
+            ON_CALL(*GetWorldMock(), getFloatConfig(CONFIG_INTEREST_NEAR_DISTANCE)).WillByDefault(Return(NEAR_DISTANCE));
+            ON_CALL(*GetWorldMock(), getIntConfig(CONFIG_INTEREST_FAR_UPDATE_INTERVAL)).WillByDefault(Return(1000));
+
+            _creature = CreateTestCreature(1, 12345, TEST_FACTION_HOSTILE_TO_ALL);
+            _creature->Relocate(0.0f, 0.0f, 0.0f);
+
+            _nearPlayer = CreateTestPlayer(1, "Near");
+            _nearPlayer->Relocate(10.0f, 0.0f, 0.0f);
+
+            _farPlayer = CreateTestPlayer(2, "Far");
+            _farPlayer->Relocate(NEAR_DISTANCE * 4, 0.0f, 0.0f);
+        }
+
+        void TearDown() override
+        {
+            _nearPlayer->GetObjectVisibilityContainer().UnlinkWorldObjectVisibility(_creature);
+            _farPlayer->GetObjectVisibilityContainer().UnlinkWorldObjectVisibility(_creature);
+
+            IntegrationTestFixture::TearDown();
+        }
+
+        TestCreature* _creature = nullptr;
+        TestPlayer* _nearPlayer = nullptr;
+        TestPlayer* _farPlayer = nullptr;
+    };
+}
+
+TEST_F(InterestTierTest, ClassifiesByDistance)
+{
+    InterestTierClassifier const interest(_creature);
+
+    EXPECT_TRUE(interest.CanBeFar());
+    EXPECT_EQ(interest.GetTier(_nearPlayer), InterestTier::Near);
+    EXPECT_EQ(interest.GetTier(_farPlayer), InterestTier::Far);
+}
+
+TEST_F(InterestTierTest, TargetingKeepsFarObserverNear)
+{
+    _farPlayer->SetGuidValue(UNIT_FIELD_TARGET, _creature->GetGUID());
+    EXPECT_EQ(InterestTierClassifier(_creature).GetTier(_farPlayer), InterestTier::Near);
+
+    _farPlayer->SetGuidValue(UNIT_FIELD_TARGET, ObjectGuid::Empty);
+    _creature->SetGuidValue(UNIT_FIELD_TARGET, _farPlayer->GetGUID());
+    EXPECT_EQ(InterestTierClassifier(_creature).GetTier(_farPlayer), InterestTier::Near);
+}
+
+TEST_F(InterestTierTest, DisabledWithoutNearDistance)
+{
+    ON_CALL(*GetWorldMock(), getFloatConfig(CONFIG_INTEREST_NEAR_DISTANCE)).WillByDefault(Return(0.0f));
+
+    InterestTierClassifier const interest(_creature);
+    EXPECT_FALSE(interest.CanBeFar());
+    EXPECT_EQ(interest.GetTier(_farPlayer), InterestTier::Near);
+}
+
+TEST_F(InterestTierTest, FarObserverGetsCoalescedUpdateAtFlush)
+{
+    _nearPlayer->GetObjectVisibilityContainer().LinkWorldObjectVisibility(_creature);
+    _farPlayer->GetObjectVisibilityContainer().LinkWorldObjectVisibility(_creature);
+
+    // Two ticks of changes, the far observer is skipped in both
+    for (uint32 health : { 9000u, 8000u })
+    {
+        _creature->SetHealth(health);
+
+        UpdateDataMapType tick;
+        _creature->BuildUpdate(tick);
+
+        EXPECT_EQ(tick.count(_nearPlayer), 1u);
+        EXPECT_EQ(tick.count(_farPlayer), 0u);
+    }
+
+    UpdateDataMapType flush;
+    _creature->BuildDeferredUpdate(flush);
+
+    ASSERT_EQ(flush.count(_farPlayer), 1u);
+    EXPECT_TRUE(flush[_farPlayer].HasData());
+    EXPECT_EQ(flush.count(_nearPlayer), 0u);
+
+    // Both ticks went out in the flush above
+    UpdateDataMapType nextFlush;
+    _creature->BuildDeferredUpdate(nextFlush);
+    EXPECT_TRUE(nextFlush.empty());
+}
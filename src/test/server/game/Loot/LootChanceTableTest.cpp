@@ -0,0 +1,105 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LootChanceTable.h"
+#include "gtest/gtest.h"
+#include <random>
+
+namespace
+{
+    // The walk LootGroup::Roll used to do over the explicitly chanced entries
+    std::size_t LinearSelect(std::vector<float> const& chances, float roll)
+    {
+        for (std::size_t i = 0; i < chances.size(); ++i)
+        {
+            if (chances[i] >= 100.0f)
+                return i;
+
+            roll -= chances[i];
+            if (roll < 0)
+                return i;
+        }
+
+        return chances.size();
+    }
+
+    LootChanceTable MakeTable(std::vector<float> const& chances)
+    {
+        LootChanceTable table;
+        for (float chance : chances)
+            table.Add(chance);
+        return table;
+    }
+}
+
+TEST(LootChanceTableTest, SelectMatchesLinearWalk)
+{
+    std::vector<float> const chances = { 0.5f, 12.0f, 3.25f, 40.0f, 0.01f, 20.0f };
+    LootChanceTable table = MakeTable(chances);
+
+    EXPECT_EQ(table.Select(0.0f), 0u);
+    EXPECT_EQ(table.Select(0.5f), 1u);
+    EXPECT_EQ(table.Select(55.0f), 3u);
+    EXPECT_EQ(table.Select(99.0f), chances.size());
+
+    std::mt19937 rng(4242);
+    std::uniform_real_distribution<float> dist(0.0f, 100.0f);
+    for (uint32 i = 0; i < 10000; ++i)
+    {
+        float roll = dist(rng);
+        EXPECT_EQ(table.Select(roll), LinearSelect(chances, roll)) << "roll " << roll;
+    }
+}
+
+TEST(LootChanceTableTest, GuaranteedEntryIsTakenWhenReached)
+{
+    std::vector<float> const chances = { 30.0f, 100.0f, 10.0f };
+    LootChanceTable table = MakeTable(chances);
+
+    EXPECT_EQ(table.Select(10.0f), 0u);
+    EXPECT_EQ(table.Select(30.0f), 1u);
+    EXPECT_EQ(table.Select(99.99f), 1u);
+}
+
+TEST(LootChanceTableTest, MonteCarloDistributionIsUnchanged)
+{
+    std::vector<float> const chances = { 1.0f, 5.0f, 14.0f, 25.0f, 35.0f };
+    LootChanceTable table = MakeTable(chances);
+    EXPECT_FLOAT_EQ(table.GetTotalChance(), 80.0f);
+
+    uint32 const samples = 200000;
+    std::vector<uint32> tableHits(chances.size() + 1, 0);
+    std::vector<uint32> linearHits(chances.size() + 1, 0);
+
+    std::mt19937 rng(1337);
+    std::uniform_real_distribution<float> dist(0.0f, 100.0f);
+    for (uint32 i = 0; i < samples; ++i)
+    {
+        float roll = dist(rng);
+        ++tableHits[table.Select(roll)];
+        ++linearHits[LinearSelect(chances, roll)];
+    }
+
+    for (std::size_t i = 0; i <= chances.size(); ++i)
+    {
+        float expected = i < chances.size() ? chances[i] : 100.0f - table.GetTotalChance();
+        float observed = 100.0f * tableHits[i] / samples;
+
+        EXPECT_EQ(tableHits[i], linearHits[i]) << "entry " << i;
+        EXPECT_NEAR(observed, expected, 0.5f) << "entry " << i;
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LineOfSightCache.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    LineOfSightCache::Key MakeTestKey(float x = 10.0f)
+    {
+        return LineOfSightCache::MakeKey(x, 20.0f, 30.0f, 40.0f, 50.0f, 60.0f, 1, 7, 0);
+    }
+}
+
+TEST(LineOfSightCacheTest, RepeatedQueryHitsCache)
+{
+    LineOfSightCache cache;
+    uint32 staticCalls = 0;
+    uint32 dynamicCalls = 0;
+    auto staticCheck = [&]() { ++staticCalls; return true; };
+    auto dynamicCheck = [&]() { ++dynamicCalls; return false; };
+
+    EXPECT_FALSE(cache.IsInLineOfSight(MakeTestKey(), true, true, staticCheck, dynamicCheck));
+    // within the quantization step
+    EXPECT_FALSE(cache.IsInLineOfSight(MakeTestKey(10.01f), true, true, staticCheck, dynamicCheck));
+
+    EXPECT_EQ(staticCalls, 1u);
+    EXPECT_EQ(dynamicCalls, 1u);
+    EXPECT_EQ(cache.GetHits(), 1u);
+    EXPECT_EQ(cache.GetMisses(), 1u);
+
+    cache.Clear();
+    EXPECT_FALSE(cache.IsInLineOfSight(MakeTestKey(), true, true, staticCheck, dynamicCheck));
+    EXPECT_EQ(staticCalls, 2u);
+}
+
+TEST(LineOfSightCacheTest, DynamicChangeOnlyRechecksGameObjects)
+{
+    LineOfSightCache cache;
+    uint32 staticCalls = 0;
+    bool doorClosed = true;
+    auto staticCheck = [&]() { ++staticCalls; return true; };
+    auto dynamicCheck = [&]() { return !doorClosed; };
+
+    EXPECT_FALSE(cache.IsInLineOfSight(MakeTestKey(), true, true, staticCheck, dynamicCheck));
+
+    doorClosed = false;
+    cache.InvalidateDynamic();
+    EXPECT_TRUE(cache.IsInLineOfSight(MakeTestKey(), true, true, staticCheck, dynamicCheck));
+    EXPECT_EQ(staticCalls, 1u);
+}
+
+TEST(LineOfSightCacheTest, StaticBlockIgnoresDynamicChanges)
+{
+    LineOfSightCache cache;
+    uint32 dynamicCalls = 0;
+    auto staticCheck = []() { return false; };
+    auto dynamicCheck = [&]() { ++dynamicCalls; return true; };
+
+    EXPECT_FALSE(cache.IsInLineOfSight(MakeTestKey(), true, true, staticCheck, dynamicCheck));
+    cache.InvalidateDynamic();
+    EXPECT_FALSE(cache.IsInLineOfSight(MakeTestKey(), true, true, staticCheck, dynamicCheck));
+    EXPECT_EQ(dynamicCalls, 0u);
+}
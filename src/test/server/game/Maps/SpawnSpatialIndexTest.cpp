@@ -0,0 +1,100 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Creature.h"
+#include "GameObject.h"
+#include "SpawnSpatialIndex.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    CreatureData MakeCreature(ObjectGuid::LowType spawnId, uint16 mapId, float x, float y, float z = 0.0f)
+    {
+        CreatureData data;
+        data.spawnId = spawnId;
+        data.mapid = mapId;
+        data.posX = x;
+        data.posY = y;
+        data.posZ = z;
+        return data;
+    }
+}
+
+TEST(SpawnSpatialIndexTest, RangeQueryIsSortedAndFiltered)
+{
+    CreatureData near = MakeCreature(1, 0, 100.0f, 100.0f);
+    CreatureData nearest = MakeCreature(2, 0, 101.0f, 100.0f);
+    CreatureData far = MakeCreature(3, 0, 150.0f, 100.0f);
+    CreatureData otherMap = MakeCreature(4, 1, 100.0f, 100.0f);
+
+    SpawnSpatialIndex index;
+    index.Insert(&near);
+    index.Insert(&nearest);
+    index.Insert(&far);
+    index.Insert(&otherMap);
+
+    SpawnSpatialIndex::SpawnList result;
+    index.GetSpawnsInRange(result, 0, 102.0f, 100.0f, 0.0f, 10.0f);
+
+    ASSERT_EQ(result.size(), 2u);
+    EXPECT_EQ(result[0], &nearest);
+    EXPECT_EQ(result[1], &near);
+}
+
+TEST(SpawnSpatialIndexTest, TypeMask)
+{
+    CreatureData creature = MakeCreature(1, 0, -500.0f, 300.0f);
+    GameObjectData gameobject;
+    gameobject.spawnId = 1;
+    gameobject.posX = -501.0f;
+    gameobject.posY = 300.0f;
+
+    SpawnSpatialIndex index;
+    index.Insert(&creature);
+    index.Insert(&gameobject);
+
+    SpawnSpatialIndex::SpawnList result;
+    index.GetSpawnsInRange(result, 0, -500.0f, 300.0f, 0.0f, 5.0f, SPAWN_TYPEMASK_GAMEOBJECT);
+
+    ASSERT_EQ(result.size(), 1u);
+    EXPECT_EQ(result[0], &gameobject);
+}
+
+TEST(SpawnSpatialIndexTest, MoveAndRemove)
+{
+    CreatureData creature = MakeCreature(1, 0, 0.0f, 0.0f);
+
+    SpawnSpatialIndex index;
+    index.Insert(&creature);
+
+    creature.posX = 2000.0f;
+    index.Insert(&creature);
+    EXPECT_EQ(index.GetSize(), 1u);
+
+    SpawnSpatialIndex::SpawnList result;
+    index.GetSpawnsInBox(result, 0, -10.0f, -10.0f, 10.0f, 10.0f);
+    EXPECT_TRUE(result.empty());
+
+    index.GetSpawnsInBox(result, 0, 1990.0f, -10.0f, 2010.0f, 10.0f);
+    ASSERT_EQ(result.size(), 1u);
+
+    index.Remove(&creature);
+    result.clear();
+    index.GetSpawnsInBox(result, 0, 1990.0f, -10.0f, 2010.0f, 10.0f);
+    EXPECT_TRUE(result.empty());
+    EXPECT_EQ(index.GetSize(), 0u);
+}
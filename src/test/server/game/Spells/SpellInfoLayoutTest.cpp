@@ -0,0 +1,55 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SpellInfoLayoutTest.cpp
+ * @brief Guards the hot/cold grouping of SpellInfo members
+ */
+
+#include "SpellInfoTestHelper.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    constexpr std::size_t CACHE_LINE = 64;
+
+    template<typename T>
+    std::size_t OffsetOf(SpellInfo const& info, T const& member)
+    {
+        return reinterpret_cast<char const*>(&member) - reinterpret_cast<char const*>(&info);
+    }
+}
+
+TEST(SpellInfoLayoutTest, HotFieldsShareTheLeadingCacheLines)
+{
+    auto info = SpellInfoBuilder().WithId(1).BuildUnique();
+
+    EXPECT_EQ(alignof(SpellInfo), CACHE_LINE);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(info.get()) % CACHE_LINE, 0u);
+
+    // Everything a proc or cast check reads before looking at effects
+    std::size_t const hotEnd = OffsetOf(*info, info->Speed) + sizeof(info->Speed);
+    EXPECT_LT(OffsetOf(*info, info->AttributesEx7), CACHE_LINE);
+    EXPECT_LT(OffsetOf(*info, info->SchoolMask), CACHE_LINE);
+    EXPECT_LT(OffsetOf(*info, info->StackAmount), 2 * CACHE_LINE);
+    EXPECT_LE(hotEnd, 3 * CACHE_LINE);
+
+    // Effects and the CheckCast fields come next, names and visuals last
+    EXPECT_GT(OffsetOf(*info, info->Effects), OffsetOf(*info, info->Speed));
+    EXPECT_GT(OffsetOf(*info, info->Totem), OffsetOf(*info, info->AreaGroupId));
+    EXPECT_GT(OffsetOf(*info, info->SpellName), OffsetOf(*info, info->Totem));
+}
@@ -17,11 +17,14 @@
 
 #define _CRT_SECURE_NO_DEPRECATE
 
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <deque>
 #include <filesystem>
+#include <mutex>
 #include <set>
+#include <thread>
 #include <unordered_map>
 #include <cstring>
 
@@ -34,6 +37,7 @@
 
 #include "dbcfile.h"
 #include "mpq_libmpq04.h"
+#include "StringConvert.h"
 #include "StringFormat.h"
 
 #include "adt.h"
@@ -88,6 +92,10 @@ enum Extract
 
 // Select data for extract
 int   CONF_extract = EXTRACT_MAP | EXTRACT_DBC | EXTRACT_CAMERA;
+// Worker threads converting ADT files, 0 - one per hardware thread
+uint32 CONF_threads = 0;
+// Skip map tiles newer than every loaded MPQ archive and extracted with the same version and options
+bool  CONF_incremental = false;
 // This option allow limit minimum height to some value (Allow save some memory)
 bool  CONF_allow_height_limit = true;
 float CONF_use_minHeight = -500.0f;
@@ -162,6 +170,8 @@ void Usage(char* prg)
         "-o set output path\n"\
         "-e extract only MAP(1)/DBC(2)/Camera(4) - standard: all(7)\n"\
         "-f height stored as int (less map size but lost some accuracy) 1 by default\n"\
+        "-t number of threads converting map tiles, all hardware threads by default\n"\
+        "-u 1 only convert map tiles older than the client archives or extracted with other options (incremental update), 0 by default\n"\
         "Example: %s -f 0 -i \"c:\\games\\game\"", prg, prg);
     exit(1);
 }
@@ -214,6 +224,34 @@ void HandleArgs(int argc, char* arg[])
                     Usage(arg[0]);
                 }
                 break;
+            case 't':
+                if (c + 1 < argc)                           // all ok
+                {
+                    Optional<uint32> threads = Acore::StringTo<uint32>(arg[(c++) + 1]);
+                    if (threads && *threads > 0)
+                    {
+                        CONF_threads = *threads;
+                    }
+                    else
+                    {
+                        Usage(arg[0]);
+                    }
+                }
+                else
+                {
+                    Usage(arg[0]);
+                }
+                break;
+            case 'u':
+                if (c + 1 < argc)                           // all ok
+                {
+                    CONF_incremental = atoi(arg[(c++) + 1]) != 0;
+                }
+                else
+                {
+                    Usage(arg[0]);
+                }
+                break;
             case 'e':
                 if (c + 1 < argc)                           // all ok
                 {
@@ -321,6 +359,7 @@ static uint32 const MAP_VERSION_MAGIC = 9;
 static char const* MAP_AREA_MAGIC    = "AREA";
 static char const* MAP_HEIGHT_MAGIC  = "MHGT";
 static char const* MAP_LIQUID_MAGIC  = "MLIQ";
+static char const* MAP_STAMP_MAGIC   = "XOPT";
 
 struct map_fileheader
 {
@@ -383,6 +422,38 @@ struct map_liquidHeader
     float  liquidLevel;
 };
 
+// Stored after the tile data, readers only follow the header offsets and never reach it.
+// An incremental run only keeps a tile whose stamp matches the current version, build and options.
+struct map_extractStamp
+{
+    uint32 fourcc;
+    uint32 versionMagic;
+    uint32 buildMagic;
+    uint32 allowFloatToInt;
+    uint32 allowHeightLimit;
+    float  useMinHeight;
+    float  floatToInt8Limit;
+    float  floatToInt16Limit;
+    float  flatHeightDeltaLimit;
+    float  flatLiquidDeltaLimit;
+};
+
+map_extractStamp GetExtractStamp(uint32 build)
+{
+    map_extractStamp stamp;
+    stamp.fourcc = *reinterpret_cast<uint32 const*>(MAP_STAMP_MAGIC);
+    stamp.versionMagic = MAP_VERSION_MAGIC;
+    stamp.buildMagic = build;
+    stamp.allowFloatToInt = CONF_allow_float_to_int;
+    stamp.allowHeightLimit = CONF_allow_height_limit;
+    stamp.useMinHeight = CONF_use_minHeight;
+    stamp.floatToInt8Limit = CONF_float_to_int8_limit;
+    stamp.floatToInt16Limit = CONF_float_to_int16_limit;
+    stamp.flatHeightDeltaLimit = CONF_flat_height_delta_limit;
+    stamp.flatLiquidDeltaLimit = CONF_flat_liquid_delta_limit;
+    return stamp;
+}
+
 float selectUInt8StepStore(float maxDiff)
 {
     return 255 / maxDiff;
@@ -392,31 +463,39 @@ float selectUInt16StepStore(float maxDiff)
 {
     return 65535 / maxDiff;
 }
-// Temporary grid data store
-uint16 area_ids[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-
-float V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-float V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
-uint16 uint16_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-uint16 uint16_V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
-uint8  uint8_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-uint8  uint8_V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
-
-uint16 liquid_entry[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-uint8 liquid_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-bool  liquid_show[ADT_GRID_SIZE][ADT_GRID_SIZE];
-float liquid_height[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
-uint16 holes[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-
-int16 flight_box_max[3][3];
-int16 flight_box_min[3][3];
+// Temporary grid data store, one per worker thread
+thread_local uint16 area_ids[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+
+thread_local float V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local float V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+thread_local uint16 uint16_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local uint16 uint16_V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+thread_local uint8  uint8_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local uint8  uint8_V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+
+thread_local uint16 liquid_entry[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local uint8 liquid_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local bool  liquid_show[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local float liquid_height[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+thread_local uint16 holes[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+
+thread_local int16 flight_box_max[3][3];
+thread_local int16 flight_box_min[3][3];
+
+// libmpq archives are not thread safe, every read from them goes through this lock
+std::mutex MpqLock;
+// Newest modification time of the opened MPQ archives, for incremental extraction
+std::filesystem::file_time_type NewestArchiveTime;
 
 bool ConvertADT(std::string const& inputPath, std::string const& outputPath, int /*cell_y*/, int /*cell_x*/, uint32 build)
 {
     ADT_file adt;
 
-    if (!adt.loadFile(inputPath))
-        return false;
+    {
+        std::lock_guard<std::mutex> lock(MpqLock);
+        if (!adt.loadFile(inputPath))
+            return false;
+    }
 
     adt_MCIN* cells = adt.a_grid->getMCIN();
     if (!cells)
@@ -908,11 +987,12 @@ bool ConvertADT(std::string const& inputPath, std::string const& outputPath, int
         map.holesSize = 0;
     }
 
-    // Ok all data prepared - store it
-    FILE* output = fopen(outputPath.c_str(), "wb");
+    // Ok all data prepared - store it, under a temporary name so a killed run never leaves a truncated tile
+    std::string const tempPath = outputPath + ".tmp";
+    FILE* output = fopen(tempPath.c_str(), "wb");
     if (!output)
     {
-        printf("Can't create the output file '%s'\n", outputPath.c_str());
+        printf("Can't create the output file '%s'\n", tempPath.c_str());
         return false;
     }
     fwrite(&map, sizeof(map), 1, output);
@@ -968,15 +1048,58 @@ bool ConvertADT(std::string const& inputPath, std::string const& outputPath, int
     if (hasHoles)
         fwrite(holes, map.holesSize, 1, output);
 
-    fclose(output);
+    map_extractStamp stamp = GetExtractStamp(build);
+    fwrite(&stamp, sizeof(stamp), 1, output);
+
+    bool const written = !ferror(output);
+    if (fclose(output) != 0 || !written)
+    {
+        printf("Can't write the output file '%s'\n", tempPath.c_str());
+        std::filesystem::remove(tempPath);
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, outputPath, error);
+    if (error)
+    {
+        printf("Can't replace the output file '%s': %s\n", outputPath.c_str(), error.message().c_str());
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
 
     return true;
 }
 
+// The tile must be newer than every archive and carry the stamp of the current version, build and options
+bool IsTileUpToDate(std::string const& outputPath, uint32 build)
+{
+    std::error_code error;
+    std::filesystem::file_time_type modified = std::filesystem::last_write_time(outputPath, error);
+    if (error || modified <= NewestArchiveTime)
+        return false;
+
+    FILE* input = fopen(outputPath.c_str(), "rb");
+    if (!input)
+        return false;
+
+    map_fileheader header;
+    map_extractStamp stamp;
+    bool const read = fread(&header, sizeof(header), 1, input) == 1
+        && fseek(input, -long(sizeof(stamp)), SEEK_END) == 0
+        && fread(&stamp, sizeof(stamp), 1, input) == 1;
+    fclose(input);
+
+    map_extractStamp const expected = GetExtractStamp(build);
+    return read
+        && header.mapMagic == *reinterpret_cast<uint32 const*>(MAP_MAGIC)
+        && header.versionMagic == MAP_VERSION_MAGIC
+        && header.buildMagic == build
+        && memcmp(&stamp, &expected, sizeof(stamp)) == 0;
+}
+
 void ExtractMapsFromMpq(uint32 build)
 {
-    std::string mpqFileName;
-    std::string outputFileName;
     std::string mpqMapName;
 
     printf("Extracting maps...\n");
@@ -989,7 +1112,9 @@ void ExtractMapsFromMpq(uint32 build)
     path += "/maps/";
     CreateDir(path);
 
-    printf("Convert map files\n");
+    uint32 threads = CONF_threads ? CONF_threads : std::max(1u, std::thread::hardware_concurrency());
+    printf("Convert map files using %u thread(s)%s\n", threads, CONF_incremental ? ", skipping up to date tiles" : "");
+
     for (uint32 z = 0; z < map_count; ++z)
     {
         printf("Extract %s (%d/%u)                  \n", map_ids[z].name, z + 1, map_count);
@@ -1002,19 +1127,49 @@ void ExtractMapsFromMpq(uint32 build)
             continue;
         }
 
+        // every tile writes its own file, so the output does not depend on which worker converts it
+        std::vector<std::pair<uint32, uint32>> tiles;
         for (uint32 y = 0; y < WDT_MAP_SIZE; ++y)
-        {
             for (uint32 x = 0; x < WDT_MAP_SIZE; ++x)
+                if (wdt.main->adt_list[y][x].exist)
+                    tiles.emplace_back(y, x);
+
+        std::atomic<std::size_t> nextTile = 0;
+        std::atomic<std::size_t> doneTiles = 0;
+        std::atomic<std::size_t> skippedTiles = 0;
+        std::mutex progressLock;
+
+        auto worker = [&]()
+        {
+            for (std::size_t i = nextTile++; i < tiles.size(); i = nextTile++)
             {
-                if (!wdt.main->adt_list[y][x].exist)
-                    continue;
-                mpqFileName = Acore::StringFormat(R"(World\Maps\{}\{}_{}_{}.adt)", map_ids[z].name, map_ids[z].name, x, y);
-                outputFileName = Acore::StringFormat("{}/maps/{:03}{:02}{:02}.map", output_path, map_ids[z].id, y, x);
-                ConvertADT(mpqFileName, outputFileName, y, x, build);
+                auto [y, x] = tiles[i];
+                std::string tileMpqName = Acore::StringFormat(R"(World\Maps\{}\{}_{}_{}.adt)", map_ids[z].name, map_ids[z].name, x, y);
+                std::string tileOutputName = Acore::StringFormat("{}/maps/{:03}{:02}{:02}.map", output_path, map_ids[z].id, y, x);
+
+                if (CONF_incremental && IsTileUpToDate(tileOutputName, build))
+                    ++skippedTiles;
+                else
+                    ConvertADT(tileMpqName, tileOutputName, y, x, build);
+
+                // draw progress bar
+                std::size_t done = ++doneTiles;
+                std::lock_guard<std::mutex> lock(progressLock);
+                printf("Processing........................%u%%\r", uint32((100 * done) / tiles.size()));
             }
-            // draw progress bar
-            printf("Processing........................%d%%\r", (100 * (y + 1)) / WDT_MAP_SIZE);
-        }
+        };
+
+        std::vector<std::thread> workers;
+        for (uint32 i = 1; i < std::min<std::size_t>(threads, tiles.size()); ++i)
+            workers.emplace_back(worker);
+
+        worker();
+
+        for (std::thread& thread : workers)
+            thread.join();
+
+        if (skippedTiles)
+            printf("Skipped %u up to date tile(s)            \n", uint32(skippedTiles));
     }
     printf("\n");
 }
@@ -1141,12 +1296,22 @@ void ExtractCameraFiles(int locale, bool basicLocale)
     printf("Extracted %u camera files\n", count);
 }
 
+void OpenMPQArchive(char const* filename)
+{
+    new MPQArchive(filename);
+
+    std::error_code error;
+    std::filesystem::file_time_type modified = std::filesystem::last_write_time(filename, error);
+    if (!error && modified > NewestArchiveTime)
+        NewestArchiveTime = modified;
+}
+
 void LoadLocaleMPQFiles(int const locale)
 {
     char filename[512];
 
     sprintf(filename, "%s/Data/%s/locale-%s.MPQ", input_path, langs[locale], langs[locale]);
-    new MPQArchive(filename);
+    OpenMPQArchive(filename);
 
     for (int i = 1; i <= 9; ++i)
     {
@@ -1156,7 +1321,7 @@ void LoadLocaleMPQFiles(int const locale)
 
         sprintf(filename, "%s/Data/%s/patch-%s%s.MPQ", input_path, langs[locale], langs[locale], ext);
         if (FileExists(filename))
-            new MPQArchive(filename);
+            OpenMPQArchive(filename);
     }
 }
 
@@ -1168,7 +1333,7 @@ void LoadCommonMPQFiles()
     {
         sprintf(filename, "%s/Data/%s", input_path, CONF_mpq_list[i]);
         if (FileExists(filename))
-            new MPQArchive(filename);
+            OpenMPQArchive(filename);
     }
 }
 
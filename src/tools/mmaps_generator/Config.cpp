@@ -190,6 +190,7 @@ namespace MMAP
         tryBoolean(mmapsNode, "skipJunkMaps", _skipJunkMaps);
         tryBoolean(mmapsNode, "skipBattlegrounds", _skipBattlegrounds);
         tryBoolean(mmapsNode, "debugOutput", _debugOutput);
+        tryBoolean(mmapsNode, "cacheHeightfields", _cacheHeightfields);
 
         if (mmapsNode.contains("offmeshConnections") && mmapsNode["offmeshConnections"].is_sequence())
         {
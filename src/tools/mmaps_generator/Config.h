@@ -70,11 +70,13 @@ namespace MMAP
         bool ShouldSkipJunkMaps() const { return _skipJunkMaps; }
         bool ShouldSkipBattlegrounds() const { return _skipBattlegrounds; }
         bool IsDebugOutputEnabled() const { return _debugOutput; }
+        bool ShouldCacheHeightfields() const { return _cacheHeightfields; }
 
         std::string VMapsPath() const { return (_dataDir / "vmaps").string(); }
         std::string MapsPath() const { return (_dataDir / "maps").string(); }
         std::string MMapsPath() const { return (_dataDir / "mmaps").string(); }
         std::string DataDirPath() const { return _dataDir.string(); }
+        std::string TileCachePath() const { return (_dataDir / "mmaps_cache").string(); }
 
         std::vector<std::string> const& OffMeshConnections() const { return _offmeshConnections; }
 
@@ -153,6 +155,7 @@ namespace MMAP
         bool _skipJunkMaps;
         bool _skipBattlegrounds;
         bool _debugOutput;
+        bool _cacheHeightfields = false;
 
         std::filesystem::path _dataDir;
 
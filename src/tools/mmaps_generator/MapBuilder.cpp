@@ -66,6 +66,7 @@ namespace MMAP
         m_mapid              (mapid),
         m_totalTiles         (0u),
         m_totalTilesProcessed(0u),
+        m_tileCache          (config->TileCachePath(), config->ShouldCacheHeightfields()),
 
         _cancelationToken    (false)
     {
@@ -455,14 +456,6 @@ namespace MMAP
     /**************************************************************************/
     void TileBuilder::buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh)
     {
-        if (shouldSkipTile(mapID, tileX, tileY))
-        {
-            ++m_mapBuilder->m_totalTilesProcessed;
-            return;
-        }
-
-        printf("%u%% [Map %04i] Building tile [%02u,%02u]\n", m_mapBuilder->currentPercentageDone(), mapID, tileX, tileY);
-
         MeshData meshData;
 
         // get heightmap data
@@ -498,8 +491,20 @@ namespace MMAP
         m_mapBuilder->getTileBounds(tileX, tileY, allVerts.getCArray(), allVerts.size() / 3, bmin, bmax);
         m_terrainBuilder->loadOffMeshConnections(mapID, tileX, tileY, meshData, m_mapBuilder->getConfig().OffMeshConnections());
 
+        // skip tiles built from the same input by an earlier run
+        ResolvedMeshConfig cfg = m_mapBuilder->getConfig().GetConfigForTile(mapID, tileX, tileY);
+        uint64 inputHash = TileCache::hashTileInput(meshData, cfg, m_terrainBuilder->usesLiquids());
+        if (shouldSkipTile(mapID, tileX, tileY) && m_mapBuilder->m_tileCache.isTileUpToDate(mapID, tileX, tileY, inputHash))
+        {
+            ++m_mapBuilder->m_totalTilesProcessed;
+            return;
+        }
+
+        printf("%u%% [Map %04i] Building tile [%02u,%02u]\n", m_mapBuilder->currentPercentageDone(), mapID, tileX, tileY);
+
         // build navmesh tile
-        buildMoveMapTile(mapID, tileX, tileY, meshData, bmin, bmax, navMesh);
+        if (buildMoveMapTile(mapID, tileX, tileY, meshData, bmin, bmax, navMesh))
+            m_mapBuilder->m_tileCache.storeTileHash(mapID, tileX, tileY, inputHash);
 
         ++m_mapBuilder->m_totalTilesProcessed;
     }
@@ -583,7 +588,7 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    void TileBuilder::buildMoveMapTile(uint32 mapID, uint32 tileX, uint32 tileY,
+    bool TileBuilder::buildMoveMapTile(uint32 mapID, uint32 tileX, uint32 tileY,
                                       MeshData& meshData, float bmin[3], float bmax[3],
                                       dtNavMesh* navMesh)
     {
@@ -622,6 +627,21 @@ namespace MMAP
         tileCfg.width = config.tileSize + config.borderSize * 2;
         tileCfg.height = config.tileSize + config.borderSize * 2;
 
+        // reuse the heightfields of an earlier run if the rasterization input is the same
+        TileCache const& tileCache = m_mapBuilder->m_tileCache;
+        uint64 heightfieldHash = 0;
+        std::vector<rcHeightfield*> cachedHeightfields;
+        std::vector<uint8> heightfieldData;
+        if (tileCache.cachesHeightfields())
+        {
+            heightfieldHash = TileCache::hashHeightfieldInput(meshData, config, tilesPerMap);
+            cachedHeightfields.resize(tilesPerMap * tilesPerMap, nullptr);
+            if (tileCache.loadHeightfields(mapID, tileX, tileY, heightfieldHash, m_rcContext, cachedHeightfields))
+                printf("%s Using cached heightfields...\n", tileString);
+            else
+                cachedHeightfields.clear();
+        }
+
         // merge per tile poly and detail meshes
         rcPolyMesh** pmmerge = new rcPolyMesh*[tilesPerMap * tilesPerMap];
         rcPolyMeshDetail** dmmerge = new rcPolyMeshDetail*[tilesPerMap * tilesPerMap];
@@ -645,28 +665,40 @@ namespace MMAP
                 tileCfg.bmax[0] += tileCfg.borderSize * tileCfg.cs;
                 tileCfg.bmax[2] += tileCfg.borderSize * tileCfg.cs;
 
-                // build heightfield
-                tile.solid = rcAllocHeightfield();
-                if (!tile.solid || !rcCreateHeightfield(m_rcContext, *tile.solid, tileCfg.width, tileCfg.height, tileCfg.bmin, tileCfg.bmax, tileCfg.cs, tileCfg.ch))
+                if (!cachedHeightfields.empty())
                 {
-                    printf("%s Failed building heightfield!            \n", tileString);
-                    continue;
+                    tile.solid = cachedHeightfields[x + y * tilesPerMap];
+                    if (!tile.solid)
+                        continue;
+                }
+                else
+                {
+                    // build heightfield
+                    tile.solid = rcAllocHeightfield();
+                    if (!tile.solid || !rcCreateHeightfield(m_rcContext, *tile.solid, tileCfg.width, tileCfg.height, tileCfg.bmin, tileCfg.bmax, tileCfg.cs, tileCfg.ch))
+                    {
+                        printf("%s Failed building heightfield!            \n", tileString);
+                        continue;
+                    }
+
+                    // mark all walkable tiles, both liquids and solids
+
+                    unsigned char* triFlags = new unsigned char[tTriCount];
+                    memset(triFlags, NAV_GROUND, tTriCount * sizeof(unsigned char));
+                    rcClearUnwalkableTriangles(m_rcContext, tileCfg.walkableSlopeAngle, tVerts, tVertCount, tTris, tTriCount, triFlags);
+                    rcRasterizeTriangles(m_rcContext, tVerts, tVertCount, tTris, triFlags, tTriCount, *tile.solid, config.walkableClimb);
+                    delete[] triFlags;
+
+                    rcFilterLowHangingWalkableObstacles(m_rcContext, config.walkableClimb, *tile.solid);
+                    rcFilterLedgeSpans(m_rcContext, tileCfg.walkableHeight, tileCfg.walkableClimb, *tile.solid);
+                    rcFilterWalkableLowHeightSpans(m_rcContext, tileCfg.walkableHeight, *tile.solid);
+
+                    // add liquid triangles
+                    rcRasterizeTriangles(m_rcContext, lVerts, lVertCount, lTris, lTriFlags, lTriCount, *tile.solid, config.walkableClimb);
+
+                    if (tileCache.cachesHeightfields())
+                        TileCache::appendHeightfield(heightfieldData, x + y * tilesPerMap, *tile.solid);
                 }
-
-                // mark all walkable tiles, both liquids and solids
-
-                unsigned char* triFlags = new unsigned char[tTriCount];
-                memset(triFlags, NAV_GROUND, tTriCount * sizeof(unsigned char));
-                rcClearUnwalkableTriangles(m_rcContext, tileCfg.walkableSlopeAngle, tVerts, tVertCount, tTris, tTriCount, triFlags);
-                rcRasterizeTriangles(m_rcContext, tVerts, tVertCount, tTris, triFlags, tTriCount, *tile.solid, config.walkableClimb);
-                delete[] triFlags;
-
-                rcFilterLowHangingWalkableObstacles(m_rcContext, config.walkableClimb, *tile.solid);
-                rcFilterLedgeSpans(m_rcContext, tileCfg.walkableHeight, tileCfg.walkableClimb, *tile.solid);
-                rcFilterWalkableLowHeightSpans(m_rcContext, tileCfg.walkableHeight, *tile.solid);
-
-                // add liquid triangles
-                rcRasterizeTriangles(m_rcContext, lVerts, lVertCount, lTris, lTriFlags, lTriCount, *tile.solid, config.walkableClimb);
 
                 // compact heightfield spans
                 tile.chf = rcAllocCompactHeightfield();
@@ -733,6 +765,9 @@ namespace MMAP
             }
         }
 
+        if (tileCache.cachesHeightfields() && cachedHeightfields.empty())
+            tileCache.storeHeightfields(mapID, tileX, tileY, heightfieldHash, heightfieldData);
+
         iv.polyMesh = rcAllocPolyMesh();
         if (!iv.polyMesh)
         {
@@ -740,7 +775,7 @@ namespace MMAP
             delete[] pmmerge;
             delete[] dmmerge;
             delete[] tiles;
-            return;
+            return false;
         }
         rcMergePolyMeshes(m_rcContext, pmmerge, nmerge, *iv.polyMesh);
 
@@ -751,7 +786,7 @@ namespace MMAP
             delete[] pmmerge;
             delete[] dmmerge;
             delete[] tiles;
-            return;
+            return false;
         }
         rcMergePolyMeshDetails(m_rcContext, dmmerge, nmerge, *iv.polyMeshDetail);
 
@@ -804,6 +839,7 @@ namespace MMAP
         // will hold final navmesh
         unsigned char* navData = nullptr;
         int navDataSize = 0;
+        bool tileWritten = false;
 
         do
         {
@@ -891,6 +927,7 @@ namespace MMAP
 
             // now that tile is written to disk, we can unload it
             navMesh->removeTile(tileRef, nullptr, nullptr);
+            tileWritten = true;
         } while (false);
 
         if (m_debugOutput)
@@ -906,6 +943,8 @@ namespace MMAP
             iv.generateObjFile(m_mapBuilder->getConfig().DataDirPath(), mapID, tileX, tileY, meshData);
             iv.writeIV(m_mapBuilder->getConfig().DataDirPath(), mapID, tileX, tileY);
         }
+
+        return tileWritten;
     }
 
     /**************************************************************************/
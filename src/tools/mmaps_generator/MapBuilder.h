@@ -27,6 +27,7 @@
 #include "Config.h"
 #include "Optional.h"
 #include "TerrainBuilder.h"
+#include "TileCache.h"
 
 #include "DetourNavMesh.h"
 #include "PCQueue.h"
@@ -98,8 +99,8 @@ namespace MMAP
         void WaitCompletion();
 
         void buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh);
-        // move map building
-        void buildMoveMapTile(uint32 mapID,
+        // move map building, returns true when the tile was written
+        bool buildMoveMapTile(uint32 mapID,
                               uint32 tileX,
                               uint32 tileY,
                               MeshData& meshData,
@@ -176,6 +177,8 @@ namespace MMAP
 
         Config* m_config;
 
+        TileCache m_tileCache;
+
         std::atomic<uint32> m_totalTiles;
         std::atomic<uint32> m_totalTilesProcessed;
 
@@ -20,6 +20,7 @@
 #include "PathCommon.h"
 #include "Timer.h"
 #include "Util.h"
+#include "WorldModelStore.h"
 #include <boost/filesystem.hpp>
 
 using namespace MMAP;
@@ -192,6 +193,9 @@ int main(int argc, char** argv)
     if (!checkDirectories(config->DataDirPath(), config->IsDebugOutputEnabled()))
         return silent ? -3 : finish("Press ENTER to close...", -3);
 
+    // TerrainBuilder reads the model geometry back through GroupModel::GetMeshData
+    sWorldModelStore->SetKeepMeshData(true);
+
     MapBuilder builder(&config.value(), mapnum, threads);
 
     uint32 start = getMSTime();
@@ -0,0 +1,289 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TileCache.h"
+#include <cstring>
+#include <filesystem>
+#include <zlib.h>
+#include "DetourNavMesh.h"
+#include "MapDefines.h"
+#include "StringFormat.h"
+
+namespace MMAP
+{
+    static constexpr uint32 TILE_HASH_MAGIC = 0x53484354; // "TCHS"
+    static constexpr uint32 HEIGHTFIELD_CACHE_MAGIC = 0x46484354; // "TCHF"
+
+    void InputHash::add(void const* data, std::size_t size)
+    {
+        uint8 const* bytes = static_cast<uint8 const*>(data);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            m_hash ^= bytes[i];
+            m_hash *= 1099511628211ULL;
+        }
+    }
+
+    TileCache::TileCache(std::string const& cachePath, bool cacheHeightfields) :
+        m_cachePath(cachePath),
+        m_cacheHeightfields(cacheHeightfields)
+    {
+        std::error_code error;
+        std::filesystem::create_directories(m_cachePath, error);
+        if (error)
+            printf("Failed to create tile cache directory %s: %s\n", m_cachePath.c_str(), error.message().c_str());
+    }
+
+    std::string TileCache::getFileName(uint32 mapID, uint32 tileX, uint32 tileY, char const* extension) const
+    {
+        return Acore::StringFormat("{}/{:03}{:02}{:02}.{}", m_cachePath, mapID, tileY, tileX, extension);
+    }
+
+    static void hashMeshGeometry(InputHash& hash, MeshData const& meshData)
+    {
+        hash.add(meshData.solidVerts);
+        hash.add(meshData.solidTris);
+        hash.add(meshData.liquidVerts);
+        hash.add(meshData.liquidTris);
+        hash.add(meshData.liquidType);
+    }
+
+    uint64 TileCache::hashTileInput(MeshData const& meshData, ResolvedMeshConfig const& config, bool usesLiquids)
+    {
+        InputHash hash;
+        hash.add(uint32(MMAP_VERSION));
+        hash.add(uint32(DT_NAVMESH_VERSION));
+        hash.add(usesLiquids);
+
+        hash.add(config.walkableSlopeAngle);
+        hash.add(config.walkableRadius);
+        hash.add(config.walkableHeight);
+        hash.add(config.walkableClimb);
+        hash.add(config.vertexPerMapEdge);
+        hash.add(config.vertexPerTileEdge);
+        hash.add(config.tilesPerMapEdge);
+        hash.add(config.baseUnitDim);
+        hash.add(config.cellSizeHorizontal);
+        hash.add(config.cellSizeVertical);
+        hash.add(config.maxSimplificationError);
+
+        hashMeshGeometry(hash, meshData);
+        hash.add(meshData.offMeshConnections);
+        hash.add(meshData.offMeshConnectionRads);
+        hash.add(meshData.offMeshConnectionDirs);
+        hash.add(meshData.offMeshConnectionsAreas);
+        hash.add(meshData.offMeshConnectionsFlags);
+        return hash.value();
+    }
+
+    uint64 TileCache::hashHeightfieldInput(MeshData const& meshData, rcConfig const& config, int tilesPerMap)
+    {
+        // only what rasterization and span filtering read
+        InputHash hash;
+        hash.add(tilesPerMap);
+        hash.add(config.bmin);
+        hash.add(config.bmax);
+        hash.add(config.cs);
+        hash.add(config.ch);
+        hash.add(config.tileSize);
+        hash.add(config.borderSize);
+        hash.add(config.walkableSlopeAngle);
+        hash.add(config.walkableHeight);
+        hash.add(config.walkableClimb);
+
+        hashMeshGeometry(hash, meshData);
+        return hash.value();
+    }
+
+    bool TileCache::isTileUpToDate(uint32 mapID, uint32 tileX, uint32 tileY, uint64 inputHash) const
+    {
+        FILE* file = fopen(getFileName(mapID, tileX, tileY, "hash").c_str(), "rb");
+        if (!file)
+            return false;
+
+        uint32 magic = 0;
+        uint64 storedHash = 0;
+        bool valid = fread(&magic, sizeof(magic), 1, file) == 1 && fread(&storedHash, sizeof(storedHash), 1, file) == 1;
+        fclose(file);
+
+        return valid && magic == TILE_HASH_MAGIC && storedHash == inputHash;
+    }
+
+    void TileCache::storeTileHash(uint32 mapID, uint32 tileX, uint32 tileY, uint64 inputHash) const
+    {
+        std::string const fileName = getFileName(mapID, tileX, tileY, "hash");
+        FILE* file = fopen(fileName.c_str(), "wb");
+        if (!file)
+        {
+            printf("[Map %03i] Failed to open %s for writing!\n", mapID, fileName.c_str());
+            return;
+        }
+
+        fwrite(&TILE_HASH_MAGIC, sizeof(TILE_HASH_MAGIC), 1, file);
+        fwrite(&inputHash, sizeof(inputHash), 1, file);
+        fclose(file);
+    }
+
+    void TileCache::appendHeightfield(std::vector<uint8>& data, uint32 index, rcHeightfield const& heightfield)
+    {
+        auto append = [&data](void const* value, std::size_t size)
+        {
+            uint8 const* bytes = static_cast<uint8 const*>(value);
+            data.insert(data.end(), bytes, bytes + size);
+        };
+
+        append(&index, sizeof(index));
+        append(&heightfield.width, sizeof(heightfield.width));
+        append(&heightfield.height, sizeof(heightfield.height));
+        append(heightfield.bmin, sizeof(heightfield.bmin));
+        append(heightfield.bmax, sizeof(heightfield.bmax));
+        append(&heightfield.cs, sizeof(heightfield.cs));
+        append(&heightfield.ch, sizeof(heightfield.ch));
+
+        for (int i = 0; i < heightfield.width * heightfield.height; ++i)
+        {
+            uint16 count = 0;
+            for (rcSpan const* span = heightfield.spans[i]; span; span = span->next)
+                ++count;
+
+            append(&count, sizeof(count));
+            for (rcSpan const* span = heightfield.spans[i]; span; span = span->next)
+            {
+                uint16 smin = span->smin;
+                uint16 smax = span->smax;
+                append(&smin, sizeof(smin));
+                append(&smax, sizeof(smax));
+                append(&span->area, sizeof(span->area));
+            }
+        }
+    }
+
+    void TileCache::storeHeightfields(uint32 mapID, uint32 tileX, uint32 tileY, uint64 inputHash, std::vector<uint8> const& data) const
+    {
+        uLongf compressedSize = compressBound(data.size());
+        std::vector<uint8> compressed(compressedSize);
+        if (compress2(compressed.data(), &compressedSize, data.data(), data.size(), Z_BEST_SPEED) != Z_OK)
+        {
+            printf("[Map %03i] [%02i,%02i]: Failed compressing heightfields!\n", mapID, tileX, tileY);
+            return;
+        }
+
+        std::string const fileName = getFileName(mapID, tileX, tileY, "hf");
+        FILE* file = fopen(fileName.c_str(), "wb");
+        if (!file)
+        {
+            printf("[Map %03i] Failed to open %s for writing!\n", mapID, fileName.c_str());
+            return;
+        }
+
+        uint32 rawSize = data.size();
+        fwrite(&HEIGHTFIELD_CACHE_MAGIC, sizeof(HEIGHTFIELD_CACHE_MAGIC), 1, file);
+        fwrite(&inputHash, sizeof(inputHash), 1, file);
+        fwrite(&rawSize, sizeof(rawSize), 1, file);
+        fwrite(compressed.data(), 1, compressedSize, file);
+        fclose(file);
+    }
+
+    bool TileCache::loadHeightfields(uint32 mapID, uint32 tileX, uint32 tileY, uint64 inputHash, rcContext* context, std::vector<rcHeightfield*>& heightfields) const
+    {
+        FILE* file = fopen(getFileName(mapID, tileX, tileY, "hf").c_str(), "rb");
+        if (!file)
+            return false;
+
+        uint32 magic = 0;
+        uint64 storedHash = 0;
+        uint32 rawSize = 0;
+        if (fread(&magic, sizeof(magic), 1, file) != 1 || fread(&storedHash, sizeof(storedHash), 1, file) != 1 ||
+            fread(&rawSize, sizeof(rawSize), 1, file) != 1 || magic != HEIGHTFIELD_CACHE_MAGIC || storedHash != inputHash)
+        {
+            fclose(file);
+            return false;
+        }
+
+        std::vector<uint8> compressed;
+        uint8 buffer[64 * 1024];
+        while (std::size_t read = fread(buffer, 1, sizeof(buffer), file))
+            compressed.insert(compressed.end(), buffer, buffer + read);
+        fclose(file);
+
+        std::vector<uint8> data(rawSize);
+        uLongf size = rawSize;
+        if (uncompress(data.data(), &size, compressed.data(), compressed.size()) != Z_OK || size != rawSize)
+            return false;
+
+        std::size_t offset = 0;
+        auto read = [&](void* value, std::size_t valueSize)
+        {
+            if (offset + valueSize > data.size())
+                return false;
+
+            memcpy(value, data.data() + offset, valueSize);
+            offset += valueSize;
+            return true;
+        };
+
+        auto fail = [&heightfields]()
+        {
+            for (rcHeightfield*& heightfield : heightfields)
+            {
+                rcFreeHeightField(heightfield);
+                heightfield = nullptr;
+            }
+
+            return false;
+        };
+
+        while (offset < data.size())
+        {
+            uint32 index;
+            int width, height;
+            float bmin[3], bmax[3], cs, ch;
+            if (!read(&index, sizeof(index)) || !read(&width, sizeof(width)) || !read(&height, sizeof(height)) ||
+                !read(bmin, sizeof(bmin)) || !read(bmax, sizeof(bmax)) || !read(&cs, sizeof(cs)) || !read(&ch, sizeof(ch)))
+                return fail();
+
+            if (index >= heightfields.size() || heightfields[index])
+                return fail();
+
+            rcHeightfield* heightfield = rcAllocHeightfield();
+            heightfields[index] = heightfield;
+            if (!heightfield || !rcCreateHeightfield(context, *heightfield, width, height, bmin, bmax, cs, ch))
+                return fail();
+
+            for (int i = 0; i < width * height; ++i)
+            {
+                uint16 count;
+                if (!read(&count, sizeof(count)))
+                    return fail();
+
+                for (uint16 j = 0; j < count; ++j)
+                {
+                    uint16 smin, smax;
+                    uint8 area;
+                    if (!read(&smin, sizeof(smin)) || !read(&smax, sizeof(smax)) || !read(&area, sizeof(area)))
+                        return fail();
+
+                    // stored spans never touch, so adding them back rebuilds the exact same columns
+                    if (!rcAddSpan(context, *heightfield, i % width, i / width, smin, smax, area, 0))
+                        return fail();
+                }
+            }
+        }
+
+        return true;
+    }
+}
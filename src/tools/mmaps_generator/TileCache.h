@@ -0,0 +1,84 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MMAP_TILE_CACHE_H
+#define _MMAP_TILE_CACHE_H
+
+#include <string>
+#include <vector>
+
+#include "Config.h"
+#include "TerrainBuilder.h"
+
+#include "Recast.h"
+
+namespace MMAP
+{
+    // 64 bit FNV-1a over the raw bytes of everything a build step reads
+    class InputHash
+    {
+    public:
+        void add(void const* data, std::size_t size);
+
+        template<class T>
+        void add(T const& value) { add(&value, sizeof(T)); }
+
+        template<class T>
+        void add(G3D::Array<T> const& values)
+        {
+            add(values.size());
+            add(values.getCArray(), values.size() * sizeof(T));
+        }
+
+        [[nodiscard]] uint64 value() const { return m_hash; }
+
+    private:
+        uint64 m_hash{14695981039346656037ULL};
+    };
+
+    // Remembers what each written mmtile was built from, so later runs only rebuild tiles whose
+    // terrain, models, off-mesh connections or mesh settings changed. Terrain of the neighbouring
+    // map tiles is part of the mesh data, so an edit also rebuilds the tiles bordering it.
+    // Optionally keeps the rasterized Recast heightfields of a tile, so a change that only
+    // affects later build steps (off-mesh connections, region and contour settings) skips rasterization.
+    class TileCache
+    {
+    public:
+        TileCache(std::string const& cachePath, bool cacheHeightfields);
+
+        static uint64 hashTileInput(MeshData const& meshData, ResolvedMeshConfig const& config, bool usesLiquids);
+        static uint64 hashHeightfieldInput(MeshData const& meshData, rcConfig const& config, int tilesPerMap);
+
+        bool isTileUpToDate(uint32 mapID, uint32 tileX, uint32 tileY, uint64 inputHash) const;
+        void storeTileHash(uint32 mapID, uint32 tileX, uint32 tileY, uint64 inputHash) const;
+
+        bool cachesHeightfields() const { return m_cacheHeightfields; }
+
+        // fills one heightfield per subtile, nullptr for subtiles which failed to build
+        bool loadHeightfields(uint32 mapID, uint32 tileX, uint32 tileY, uint64 inputHash, rcContext* context, std::vector<rcHeightfield*>& heightfields) const;
+        static void appendHeightfield(std::vector<uint8>& data, uint32 index, rcHeightfield const& heightfield);
+        void storeHeightfields(uint32 mapID, uint32 tileX, uint32 tileY, uint64 inputHash, std::vector<uint8> const& data) const;
+
+    private:
+        std::string getFileName(uint32 mapID, uint32 tileX, uint32 tileY, char const* extension) const;
+
+        std::string m_cachePath;
+        bool m_cacheHeightfields;
+    };
+}
+
+#endif
@@ -17,30 +17,55 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 
+#include "StringConvert.h"
 #include "TileAssembler.h"
 
 int main(int argc, char* argv[])
 {
     std::string src = "Buildings";
     std::string dest = "vmaps";
+    uint32 threads = 0;
+    bool incremental = false;
 
-    if (argc > 3)
+    std::vector<std::string> positional;
+    for (int i = 1; i < argc; ++i)
     {
-        std::cout << "usage: " << argv[0] << " <raw data dir> <vmap dest dir>" << std::endl;
-        return 1;
+        std::string arg = argv[i];
+        if (arg == "-t" && i + 1 < argc)
+        {
+            Optional<uint32> value = Acore::StringTo<uint32>(argv[++i]);
+            if (!value || !*value)
+            {
+                std::cout << "invalid thread count '" << argv[i] << "', expected a positive number" << std::endl;
+                return 1;
+            }
+
+            threads = *value;
+        }
+        else if (arg == "-u")
+            incremental = true;
+        else
+            positional.push_back(arg);
     }
-    else
+
+    if (positional.size() > 2)
     {
-        if (argc > 1)
-            src = argv[1];
-        if (argc > 2)
-            dest = argv[2];
+        std::cout << "usage: " << argv[0] << " [-t threads] [-u] <raw data dir> <vmap dest dir>" << std::endl;
+        std::cout << "  -t  number of worker threads, all hardware threads by default" << std::endl;
+        std::cout << "  -u  only convert models whose raw file is newer than the existing output or whose output has another format version" << std::endl;
+        return 1;
     }
 
+    if (positional.size() > 0)
+        src = positional[0];
+    if (positional.size() > 1)
+        dest = positional[1];
+
     std::cout << "using " << src << " as source directory and writing output to " << dest << std::endl;
 
-    VMAP::TileAssembler* ta = new VMAP::TileAssembler(src, dest);
+    VMAP::TileAssembler* ta = new VMAP::TileAssembler(src, dest, threads, incremental);
 
     if (!ta->convertWorld2())
     {